@@ -0,0 +1,82 @@
+#include "Benchmark.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <utility>
+
+#include <Hazel.h>
+#include <Platform/Null/NullRecorder.h>
+
+namespace Benchmarks {
+
+void Suite::add(std::string name, SceneFn scene)
+{
+    cases_.push_back(Case{std::move(name), std::move(scene)});
+}
+
+std::vector<Result> Suite::run(Options const& options) const
+{
+    std::vector<Result> results;
+    for (auto const& bench_case : cases_) {
+        if (bench_case.name.find(options.filter) == std::string::npos) {
+            continue;
+        }
+        for (auto const quad_count : options.scene_sizes) {
+            results.push_back(runCase(bench_case, quad_count, options));
+        }
+    }
+    return results;
+}
+
+Result Suite::runCase(Case const& bench_case, std::uint32_t quad_count, Options const& options) const
+{
+    using clock = std::chrono::steady_clock;
+    static const Hazel::OrthographicCamera camera{-16.0f, 16.0f, -9.0f, 9.0f};
+    auto& recorder{Hazel::NullRecorder::get()};
+
+    auto const frames{static_cast<std::uint32_t>(
+        std::max<std::uint64_t>(options.min_frames, options.min_total_quads / std::max(quad_count, 1u)))};
+
+    auto const run_frame = [&]() {
+        recorder.reset();
+        Hazel::Renderer2D::resetStats();
+        Hazel::Renderer2D::beginScene(camera);
+        bench_case.scene(quad_count);
+        Hazel::Renderer2D::endScene();
+    };
+
+    // warm-up, also touches all of the batch buffers once
+    run_frame();
+
+    clock::duration elapsed{};
+    for (std::uint32_t frame{0}; frame != frames; ++frame) {
+        auto const start{clock::now()};
+        run_frame();
+        elapsed += clock::now() - start;
+    }
+
+    Result result{};
+    result.name = bench_case.name;
+    result.quads_per_scene = quad_count;
+    result.frames = frames;
+    result.ns_per_quad = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()) /
+                         (static_cast<double>(frames) * quad_count);
+    // every frame submits the same scene, so the last one is representative
+    result.bytes_per_frame = recorder.getVertexBytesUploaded();
+    result.flushes_per_frame = Hazel::Renderer2D::getStats().draw_calls;
+    return result;
+}
+
+void printResults(std::vector<Result> const& results)
+{
+    std::printf("%-44s %10s %8s %10s %16s %10s\n", "case", "quads", "frames", "ns/quad", "bytes/frame",
+                "flushes");
+    std::printf("%s\n", std::string(103, '-').c_str());
+    for (auto const& r : results) {
+        std::printf("%-44s %10u %8u %10.2f %16llu %10u\n", r.name.c_str(), r.quads_per_scene, r.frames,
+                    r.ns_per_quad, static_cast<unsigned long long>(r.bytes_per_frame), r.flushes_per_frame);
+    }
+}
+
+}  // namespace Benchmarks
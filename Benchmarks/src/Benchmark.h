@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace Benchmarks {
+
+struct Options {
+    // Only cases whose name contains this substring are run
+    std::string filter{};
+    std::vector<std::uint32_t> scene_sizes{1'000, 10'000, 100'000, 1'000'000};
+    // Each (case, scene size) pair runs for at least this many quads and at least min_frames frames,
+    // so that small scenes are timed over enough frames to be meaningful
+    std::uint64_t min_total_quads{4'000'000};
+    std::uint32_t min_frames{3};
+};
+
+struct Result {
+    std::string name;
+    std::uint32_t quads_per_scene{};
+    std::uint32_t frames{};
+    double ns_per_quad{};
+    std::uint64_t bytes_per_frame{};
+    std::uint32_t flushes_per_frame{};
+};
+
+// A set of named benchmark cases, each submitting a given number of quads into an already begun
+// Renderer2D scene. The suite takes care of beginning/ending the scene and of reading the
+// measurements back from the Null backend.
+class Suite {
+public:
+    using SceneFn = std::function<void(std::uint32_t quad_count)>;
+
+    void add(std::string name, SceneFn scene);
+    std::vector<Result> run(Options const& options) const;
+
+private:
+    struct Case {
+        std::string name;
+        SceneFn scene;
+    };
+
+    Result runCase(Case const& bench_case, std::uint32_t quad_count, Options const& options) const;
+
+    std::vector<Case> cases_{};
+};
+
+void printResults(std::vector<Result> const& results);
+
+void registerRenderer2DBenchmarks(Suite& suite);
+
+}  // namespace Benchmarks
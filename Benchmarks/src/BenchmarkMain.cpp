@@ -0,0 +1,49 @@
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#include <Hazel.h>
+
+#include "Benchmark.h"
+
+// Headless micro-benchmarks for the renderer hot paths.
+// All of the work is recorded by the Null RendererAPI backend, so no window or GPU is required.
+//
+// usage: Benchmarks [--filter <substring>] [--max-quads <count>] [--min-quads <total>]
+int main(int argc, char** argv)
+{
+    Benchmarks::Options options{};
+    for (int i{1}; i < argc; ++i) {
+        auto const has_value{i + 1 < argc};
+        if (!std::strcmp(argv[i], "--filter") && has_value) {
+            options.filter = argv[++i];
+        }
+        else if (!std::strcmp(argv[i], "--max-quads") && has_value) {
+            auto const max_quads{static_cast<std::uint32_t>(std::strtoul(argv[++i], nullptr, 10))};
+            options.scene_sizes.erase(std::remove_if(options.scene_sizes.begin(), options.scene_sizes.end(),
+                                                     [=](auto size) { return size > max_quads; }),
+                                      options.scene_sizes.end());
+        }
+        else if (!std::strcmp(argv[i], "--min-quads") && has_value) {
+            options.min_total_quads = std::strtoull(argv[++i], nullptr, 10);
+        }
+        else {
+            std::fprintf(stderr, "usage: %s [--filter <substring>] [--max-quads <count>] [--min-quads <total>]\n",
+                         argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    Hazel::Log::Init();
+    Hazel::RendererAPI::setAPI(Hazel::RendererAPI::API::Null);
+    Hazel::Renderer::init();
+
+    Benchmarks::Suite suite{};
+    Benchmarks::registerRenderer2DBenchmarks(suite);
+    Benchmarks::printResults(suite.run(options));
+
+    Hazel::Renderer2D::shutdown();
+    return EXIT_SUCCESS;
+}
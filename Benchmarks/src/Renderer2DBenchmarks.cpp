@@ -0,0 +1,454 @@
+#include <Hazel.h>
+#include <Hazel/Core/CpuFeatures.h>
+#include <Hazel/Renderer/QuadKernels.h>
+
+#include "Benchmark.h"
+
+namespace Benchmarks {
+
+namespace {
+const glm::vec2 quad_size{0.015f, 0.015f};
+
+// Spread the quads over a 1000 x 1000 grid so that every submitted vertex differs
+inline glm::vec2 gridPosition(std::uint32_t i) noexcept
+{
+    return {static_cast<float>(i % 1000u) * 0.02f - 10.0f, static_cast<float>((i / 1000u) % 1000u) * 0.02f - 10.0f};
+}
+
+inline glm::vec3 gridPosition3(std::uint32_t i) noexcept
+{
+    return {gridPosition(i), static_cast<float>(i % 7u) * 0.01f};
+}
+
+// The grid stretched over about 50 times the area seen by the benchmark camera - culling leaves ~2% of the quads.
+// Consecutive quads are scattered over the whole grid, so that scenes of any size are spread evenly.
+inline glm::vec3 worldPosition3(std::uint32_t i) noexcept
+{
+    auto const position{gridPosition3((i * 7919u) % 1'000'000u)};
+    return {position.x * 11.3f, position.y * 6.4f, position.z};
+}
+
+inline glm::vec4 gridColor(std::uint32_t i) noexcept
+{
+    return {static_cast<float>(i & 0xFFu) / 255.0f, static_cast<float>((i >> 8) & 0xFFu) / 255.0f, 0.5f, 1.0f};
+}
+
+inline glm::mat4 gridTransform(std::uint32_t i) noexcept
+{
+    auto const position{gridPosition3(i)};
+    glm::mat4 transform{1.0f};
+    transform[0][0] = quad_size.x;
+    transform[1][1] = quad_size.y;
+    transform[3] = glm::vec4{position, 1.0f};
+    return transform;
+}
+
+inline float gridRotation(std::uint32_t i) noexcept { return static_cast<float>(i % 360u); }
+
+std::vector<Hazel::QuadInstance> makeQuadInstances(std::uint32_t count, bool rotated, bool world = false)
+{
+    std::vector<Hazel::QuadInstance> quads(count);
+    for (std::uint32_t i{0}; i != count; ++i) {
+        auto& quad{quads[i]};
+        quad.position = world ? worldPosition3(i) : gridPosition3(i);
+        quad.rotation = rotated ? gridRotation(i) : 0.0f;
+        quad.size = quad_size;
+        quad.color = gridColor(i);
+    }
+    return quads;
+}
+
+// Runs `scene` with Renderer2D in `mode`. Switching back to the batched mode at the end flushes
+// the quads, so the upload and draw are measured just like for the other cases.
+Suite::SceneFn withQuadMode(Hazel::Renderer2D::QuadMode mode, Suite::SceneFn scene)
+{
+    return [mode, scene = std::move(scene)](std::uint32_t n) {
+        Hazel::Renderer2D::setQuadMode(mode);
+        scene(n);
+        Hazel::Renderer2D::setQuadMode(Hazel::Renderer2D::QuadMode::Batched);
+    };
+}
+
+Suite::SceneFn instanced(Suite::SceneFn scene)
+{
+    return withQuadMode(Hazel::Renderer2D::QuadMode::Instanced, std::move(scene));
+}
+
+Suite::SceneFn compact(Suite::SceneFn scene)
+{
+    return withQuadMode(Hazel::Renderer2D::QuadMode::Compact, std::move(scene));
+}
+
+// Runs `scene` in SubmitMode::Deferred - switching back to the immediate mode sorts and batches the quads.
+// The worker threads are started during the warm-up frame.
+Suite::SceneFn deferred(Suite::SceneFn scene, std::uint32_t worker_threads = 0)
+{
+    return [scene = std::move(scene), worker_threads](std::uint32_t n) {
+        Hazel::Renderer2D::setWorkerThreadCount(worker_threads);
+        Hazel::Renderer2D::setSubmitMode(Hazel::Renderer2D::SubmitMode::Deferred);
+        scene(n);
+        Hazel::Renderer2D::setSubmitMode(Hazel::Renderer2D::SubmitMode::Immediate);
+    };
+}
+
+// Runs `scene` with quad culling enabled
+Suite::SceneFn culled(Suite::SceneFn scene)
+{
+    return [scene = std::move(scene)](std::uint32_t n) {
+        Hazel::Renderer2D::setCulling(true);
+        scene(n);
+        Hazel::Renderer2D::setCulling(false);
+    };
+}
+
+// Runs a QuadKernel directly, writing batch-sized chunks into a single staging buffer
+void registerQuadKernelBenchmark(Suite& suite, std::string const& name, Hazel::QuadKernel kernel,
+                                 std::shared_ptr<std::vector<Hazel::QuadInstance> const> const& quads)
+{
+    static constexpr std::uint32_t batch_quads{10'000};
+    struct alignas(64) Staging {
+        std::array<Hazel::QuadVertex, batch_quads * 4> vertices;
+    };
+    auto const staging{std::make_shared<Staging>()};
+    suite.add(name, [kernel, quads, staging](std::uint32_t n) {
+        for (std::uint32_t offset{0}; offset < n; offset += batch_quads) {
+            auto const count{std::min(batch_quads, n - offset)};
+            kernel(quads->data() + offset, count, 0.0f, 1.0f, staging->vertices.data());
+        }
+    });
+}
+}  // namespace
+
+void registerRenderer2DBenchmarks(Suite& suite)
+{
+    using Hazel::Renderer2D;
+
+    auto const texture{Hazel::Texture2D::create(64, 64)};
+    auto const sheet{Hazel::Texture2D::create(256, 256)};
+    auto const subtexture{Hazel::SubTexture2D::createFromCoords(sheet, {1, 2}, {16, 16})};
+
+    suite.add("drawQuad(vec2, color)", [](std::uint32_t n) {
+        for (std::uint32_t i{0}; i != n; ++i) {
+            Renderer2D::drawQuad(gridPosition(i), quad_size, gridColor(i));
+        }
+    });
+    suite.add("drawQuad(vec3, color)", [](std::uint32_t n) {
+        for (std::uint32_t i{0}; i != n; ++i) {
+            Renderer2D::drawQuad(gridPosition3(i), quad_size, gridColor(i));
+        }
+    });
+    suite.add("drawQuad(vec2, Texture2D)", [texture](std::uint32_t n) {
+        for (std::uint32_t i{0}; i != n; ++i) {
+            Renderer2D::drawQuad(gridPosition(i), quad_size, texture, 2.0f, gridColor(i));
+        }
+    });
+    suite.add("drawQuad(vec3, Texture2D)", [texture](std::uint32_t n) {
+        for (std::uint32_t i{0}; i != n; ++i) {
+            Renderer2D::drawQuad(gridPosition3(i), quad_size, texture, 2.0f, gridColor(i));
+        }
+    });
+    suite.add("drawQuad(vec2, SubTexture2D)", [subtexture](std::uint32_t n) {
+        for (std::uint32_t i{0}; i != n; ++i) {
+            Renderer2D::drawQuad(gridPosition(i), quad_size, subtexture, 1.0f, gridColor(i));
+        }
+    });
+    suite.add("drawQuad(vec3, SubTexture2D)", [subtexture](std::uint32_t n) {
+        for (std::uint32_t i{0}; i != n; ++i) {
+            Renderer2D::drawQuad(gridPosition3(i), quad_size, subtexture, 1.0f, gridColor(i));
+        }
+    });
+    // More distinct textures than there are texture slots - every 31 textures force a new batch
+    auto const many_textures{std::make_shared<std::vector<Hazel::Ref<Hazel::Texture2D>>>()};
+    for (int i{0}; i != 40; ++i) {
+        many_textures->push_back(Hazel::Texture2D::create(16, 16));
+    }
+    suite.add("drawQuad(vec3, 40 Texture2Ds)", [many_textures](std::uint32_t n) {
+        for (std::uint32_t i{0}; i != n; ++i) {
+            Renderer2D::drawQuad(gridPosition3(i), quad_size, (*many_textures)[(i / 16u) % 40u], 1.0f,
+                                 gridColor(i));
+        }
+    });
+    suite.add("deferred drawQuad(vec3, 40 Texture2Ds)", deferred([many_textures](std::uint32_t n) {
+                  for (std::uint32_t i{0}; i != n; ++i) {
+                      Renderer2D::drawQuad(gridPosition3(i), quad_size, (*many_textures)[(i / 16u) % 40u], 1.0f,
+                                           gridColor(i));
+                  }
+              }));
+    // The same 40 images packed into a single atlas page - no batch breaks
+    auto const atlas{std::make_shared<Hazel::TextureAtlas>()};
+    std::vector<std::uint8_t> const atlas_image(16 * 16 * 4, 0xFF);
+    for (int i{0}; i != 40; ++i) {
+        atlas->add(16, 16, atlas_image.data());
+    }
+    atlas->build();
+    suite.add("drawQuad(vec3, 40 atlas SubTexture2Ds)", [atlas](std::uint32_t n) {
+        for (std::uint32_t i{0}; i != n; ++i) {
+            Renderer2D::drawQuad(gridPosition3(i), quad_size, atlas->getSubTexture((i / 16u) % 40u), 1.0f,
+                                 gridColor(i));
+        }
+    });
+    suite.add("drawQuad(mat4, color)", [](std::uint32_t n) {
+        for (std::uint32_t i{0}; i != n; ++i) {
+            Renderer2D::drawQuad(gridTransform(i), gridColor(i));
+        }
+    });
+    suite.add("drawQuad(mat4, Texture2D)", [texture](std::uint32_t n) {
+        for (std::uint32_t i{0}; i != n; ++i) {
+            Renderer2D::drawQuad(gridTransform(i), texture, 2.0f, gridColor(i));
+        }
+    });
+    suite.add("drawQuad(mat4, SubTexture2D)", [subtexture](std::uint32_t n) {
+        for (std::uint32_t i{0}; i != n; ++i) {
+            Renderer2D::drawQuad(gridTransform(i), subtexture, 1.0f, gridColor(i));
+        }
+    });
+
+    constexpr std::uint32_t max_instances{1'000'000};
+    auto const instances{std::make_shared<std::vector<Hazel::QuadInstance> const>(makeQuadInstances(max_instances, false))};
+    auto const rotated_instances{
+        std::make_shared<std::vector<Hazel::QuadInstance> const>(makeQuadInstances(max_instances, true))};
+    suite.add("drawQuads(color)", [instances](std::uint32_t n) { Renderer2D::drawQuads(instances->data(), n); });
+    suite.add("drawQuads(Texture2D)", [instances, texture](std::uint32_t n) {
+        Renderer2D::drawQuads(instances->data(), n, texture, 2.0f);
+    });
+    suite.add("drawQuads(rotated, color)",
+              [rotated_instances](std::uint32_t n) { Renderer2D::drawQuads(rotated_instances->data(), n); });
+
+    registerQuadKernelBenchmark(suite, "QuadKernel scalar", Hazel::writeQuadsScalar, rotated_instances);
+#if HZ_ARCH_X86
+    if (Hazel::CpuFeatures::get().sse2) {
+        registerQuadKernelBenchmark(suite, "QuadKernel SSE2", Hazel::writeQuadsSSE2, rotated_instances);
+    }
+    if (Hazel::CpuFeatures::get().avx2) {
+        registerQuadKernelBenchmark(suite, "QuadKernel AVX2", Hazel::writeQuadsAVX2, rotated_instances);
+    }
+#endif
+
+    suite.add("drawQuadRotated(vec2, color)", [](std::uint32_t n) {
+        for (std::uint32_t i{0}; i != n; ++i) {
+            Renderer2D::drawQuadRotated(gridPosition(i), quad_size, gridRotation(i), gridColor(i));
+        }
+    });
+    suite.add("drawQuadRotated(vec3, color)", [](std::uint32_t n) {
+        for (std::uint32_t i{0}; i != n; ++i) {
+            Renderer2D::drawQuadRotated(gridPosition3(i), quad_size, gridRotation(i), gridColor(i));
+        }
+    });
+    suite.add("drawQuadRotated(vec2, Texture2D)", [texture](std::uint32_t n) {
+        for (std::uint32_t i{0}; i != n; ++i) {
+            Renderer2D::drawQuadRotated(gridPosition(i), quad_size, gridRotation(i), texture, 2.0f, gridColor(i));
+        }
+    });
+    suite.add("drawQuadRotated(vec3, Texture2D)", [texture](std::uint32_t n) {
+        for (std::uint32_t i{0}; i != n; ++i) {
+            Renderer2D::drawQuadRotated(gridPosition3(i), quad_size, gridRotation(i), texture, 2.0f, gridColor(i));
+        }
+    });
+    suite.add("drawQuadRotated(vec2, SubTexture2D)", [subtexture](std::uint32_t n) {
+        for (std::uint32_t i{0}; i != n; ++i) {
+            Renderer2D::drawQuadRotated(gridPosition(i), quad_size, gridRotation(i), subtexture, 1.0f,
+                                        gridColor(i));
+        }
+    });
+    suite.add("drawQuadRotated(vec3, SubTexture2D)", [subtexture](std::uint32_t n) {
+        for (std::uint32_t i{0}; i != n; ++i) {
+            Renderer2D::drawQuadRotated(gridPosition3(i), quad_size, gridRotation(i), subtexture, 1.0f,
+                                        gridColor(i));
+        }
+    });
+
+    suite.add("instanced drawQuad(vec3, color)", instanced([](std::uint32_t n) {
+                  for (std::uint32_t i{0}; i != n; ++i) {
+                      Renderer2D::drawQuad(gridPosition3(i), quad_size, gridColor(i));
+                  }
+              }));
+    suite.add("instanced drawQuad(vec3, SubTexture2D)", instanced([subtexture](std::uint32_t n) {
+                  for (std::uint32_t i{0}; i != n; ++i) {
+                      Renderer2D::drawQuad(gridPosition3(i), quad_size, subtexture, 1.0f, gridColor(i));
+                  }
+              }));
+    suite.add("instanced drawQuad(mat4, color)", instanced([](std::uint32_t n) {
+                  for (std::uint32_t i{0}; i != n; ++i) {
+                      Renderer2D::drawQuad(gridTransform(i), gridColor(i));
+                  }
+              }));
+    suite.add("instanced drawQuadRotated(vec3, color)", instanced([](std::uint32_t n) {
+                  for (std::uint32_t i{0}; i != n; ++i) {
+                      Renderer2D::drawQuadRotated(gridPosition3(i), quad_size, gridRotation(i), gridColor(i));
+                  }
+              }));
+    suite.add("instanced drawQuads(rotated, color)", instanced([rotated_instances](std::uint32_t n) {
+                  Renderer2D::drawQuads(rotated_instances->data(), n);
+              }));
+
+    suite.add("deferred drawQuad(vec3, color)", deferred([](std::uint32_t n) {
+                  for (std::uint32_t i{0}; i != n; ++i) {
+                      Renderer2D::drawQuad(gridPosition3(i), quad_size, gridColor(i));
+                  }
+              }));
+    suite.add("deferred drawQuads(rotated, color)", deferred([rotated_instances](std::uint32_t n) {
+                  Renderer2D::drawQuads(rotated_instances->data(), n);
+              }));
+    suite.add("deferred drawQuad(vec3, color), 3 workers",
+              deferred(
+                  [](std::uint32_t n) {
+                      for (std::uint32_t i{0}; i != n; ++i) {
+                          Renderer2D::drawQuad(gridPosition3(i), quad_size, gridColor(i));
+                      }
+                  },
+                  3));
+    suite.add("deferred drawQuads(rotated, color), 3 workers",
+              deferred([rotated_instances](std::uint32_t n) { Renderer2D::drawQuads(rotated_instances->data(), n); },
+                       3));
+
+    suite.add("compact drawQuad(vec3, color)", compact([](std::uint32_t n) {
+                  for (std::uint32_t i{0}; i != n; ++i) {
+                      Renderer2D::drawQuad(gridPosition3(i), quad_size, gridColor(i));
+                  }
+              }));
+    suite.add("compact drawQuad(vec3, SubTexture2D)", compact([subtexture](std::uint32_t n) {
+                  for (std::uint32_t i{0}; i != n; ++i) {
+                      Renderer2D::drawQuad(gridPosition3(i), quad_size, subtexture, 1.0f, gridColor(i));
+                  }
+              }));
+    suite.add("compact drawQuadRotated(vec3, color)", compact([](std::uint32_t n) {
+                  for (std::uint32_t i{0}; i != n; ++i) {
+                      Renderer2D::drawQuadRotated(gridPosition3(i), quad_size, gridRotation(i), gridColor(i));
+                  }
+              }));
+    suite.add("compact drawQuads(rotated, color)", compact([rotated_instances](std::uint32_t n) {
+                  Renderer2D::drawQuads(rotated_instances->data(), n);
+              }));
+
+    suite.add("drawQuad(vec3, color), 50x viewport", [](std::uint32_t n) {
+        for (std::uint32_t i{0}; i != n; ++i) {
+            Renderer2D::drawQuad(worldPosition3(i), quad_size, gridColor(i));
+        }
+    });
+    suite.add("culled drawQuad(vec3, color), 50x viewport", culled([](std::uint32_t n) {
+                  for (std::uint32_t i{0}; i != n; ++i) {
+                      Renderer2D::drawQuad(worldPosition3(i), quad_size, gridColor(i));
+                  }
+              }));
+    suite.add("culled drawQuadRotated(vec3, color), 50x viewport", culled([](std::uint32_t n) {
+                  for (std::uint32_t i{0}; i != n; ++i) {
+                      Renderer2D::drawQuadRotated(worldPosition3(i), quad_size, gridRotation(i), gridColor(i));
+                  }
+              }));
+    auto const world_instances{
+        std::make_shared<std::vector<Hazel::QuadInstance> const>(makeQuadInstances(max_instances, true, true))};
+    suite.add("culled drawQuads(rotated, color), 50x viewport", culled([world_instances](std::uint32_t n) {
+                  Renderer2D::drawQuads(world_instances->data(), n);
+              }));
+
+    // The batch is rebuilt whenever the scene size changes - that is, in the warm-up frame
+    auto const static_batch{std::make_shared<Hazel::StaticBatch>()};
+    suite.add("drawStaticBatch(Texture2D)", [static_batch, texture](std::uint32_t n) {
+        if (static_batch->getQuadCount() != n) {
+            static_batch->clear();
+            for (std::uint32_t i{0}; i != n; ++i) {
+                static_batch->addQuad(gridPosition3(i), quad_size, texture, 1.0f, gridColor(i));
+            }
+            static_batch->build();
+        }
+        Renderer2D::drawStaticBatch(*static_batch);
+    });
+
+    // A 4096 x 4096 tile world, with tiles sized so that about n of them are visible to the benchmark camera.
+    // The map is rebuilt whenever the scene size changes - that is, in the warm-up frame, which also bakes every
+    // visible chunk.
+    struct TilemapScene {
+        std::uint32_t visible_tiles{0};
+        Hazel::Scope<Hazel::Tilemap> tilemap;
+        std::uint32_t frame{0};
+    };
+    auto const tilemap_scene{std::make_shared<TilemapScene>()};
+    auto const tilemap_subtextures{std::make_shared<std::vector<Hazel::Ref<Hazel::SubTexture2D>>>()};
+    for (std::uint32_t i{0}; i != 4; ++i) {
+        tilemap_subtextures->push_back(std::make_shared<Hazel::SubTexture2D>(texture, glm::vec2{i * 0.25f, 0.0f},
+                                                                      glm::vec2{(i + 1) * 0.25f, 0.25f}));
+    }
+    auto const tilemap_for{[tilemap_scene, tilemap_subtextures](std::uint32_t n) -> Hazel::Tilemap& {
+        if (tilemap_scene->visible_tiles != n) {
+            constexpr float view_area{32.0f * 18.0f};  // see the benchmark camera
+            Hazel::TilemapSpecification spec;
+            spec.width = 4096;
+            spec.height = 4096;
+            spec.tile_size = glm::vec2{std::sqrt(view_area / static_cast<float>(n))};
+            spec.origin = {-2048.0f * spec.tile_size.x, -2048.0f * spec.tile_size.y, 0.0f};
+            tilemap_scene->tilemap = Hazel::makeScope<Hazel::Tilemap>(spec);
+            auto& tilemap{*tilemap_scene->tilemap};
+            for (auto const& subtexture : *tilemap_subtextures) {
+                tilemap.addTileType(subtexture);
+            }
+            for (std::uint32_t y{0}; y != spec.height; ++y) {
+                for (std::uint32_t x{0}; x != spec.width; ++x) {
+                    tilemap.setTile(x, y, static_cast<Hazel::Tilemap::Tile>(1 + (x * 7 + y * 13) % 4));
+                }
+            }
+            tilemap_scene->visible_tiles = n;
+        }
+        return *tilemap_scene->tilemap;
+    }};
+    static const Hazel::OrthographicCamera tilemap_camera{-16.0f, 16.0f, -9.0f, 9.0f};
+    suite.add("Tilemap 4096x4096, n visible tiles", [tilemap_for](std::uint32_t n) {
+        tilemap_for(n).draw(tilemap_camera);
+    });
+    // Every visible chunk has to be re-baked
+    suite.add("Tilemap 4096x4096, n visible tiles, 1 edit per chunk", [tilemap_for, tilemap_scene](std::uint32_t n) {
+        auto& tilemap{tilemap_for(n)};
+        auto const& spec{tilemap.getSpecification()};
+        auto const tile{static_cast<Hazel::Tilemap::Tile>(1 + tilemap_scene->frame++ % 4)};
+        for (std::uint32_t y{0}; y < spec.height; y += spec.chunk_size) {
+            for (std::uint32_t x{0}; x < spec.width; x += spec.chunk_size) {
+                tilemap.setTile(x, y, tile);
+            }
+        }
+        tilemap.draw(tilemap_camera);
+    });
+
+    // Particles live for longer than the benchmark runs - the pool is topped up to n in the warm-up frame and only
+    // re-created when the scene size changes
+    auto const particles_for{[](std::uint32_t worker_threads) {
+        auto const particles{std::make_shared<Hazel::Scope<Hazel::ParticleSystem>>()};
+        return [particles, worker_threads](std::uint32_t n) {
+            auto& system{*particles};
+            if (!system || system->getMaxParticles() != n) {
+                system = Hazel::makeScope<Hazel::ParticleSystem>(n);
+                system->setWorkerThreadCount(worker_threads);
+                Hazel::ParticleProps props{};
+                props.velocity_variation = {3.0f, 0.5f};
+                props.color_begin = {1.0f, 0.8f, 0.5f, 1.0f};
+                props.color_end = {1.0f, 0.4f, 0.2f, 1.0f};
+                props.size_begin = 0.02f;
+                props.size_end = 0.0f;
+                props.size_variation = 0.01f;
+                props.lifetime = 1.0e6f;
+                for (std::uint32_t i{0}; i != n; ++i) {
+                    props.position = gridPosition(i);
+                    system->emit(props);
+                }
+            }
+            system->onUpdate(1.0f / 60.0f);
+            system->draw();
+        };
+    }};
+    suite.add("ParticleSystem onUpdate + draw, n live particles", particles_for(0));
+    suite.add("ParticleSystem onUpdate + draw, n live particles, 3 workers", particles_for(3));
+
+    // A burst of n particles into a pool that is already full - measures emission alone, nothing is drawn
+    auto const burst{std::make_shared<Hazel::Scope<Hazel::ParticleSystem>>()};
+    suite.add("ParticleSystem emit, burst of n particles", [burst](std::uint32_t n) {
+        auto& system{*burst};
+        if (!system || system->getMaxParticles() != n) {
+            system = Hazel::makeScope<Hazel::ParticleSystem>(n);
+        }
+        Hazel::ParticleProps props{};
+        props.velocity_variation = {3.0f, 0.5f};
+        props.size_begin = 0.02f;
+        props.size_variation = 0.01f;
+        system->emit(props, n);
+    });
+}
+
+}  // namespace Benchmarks
@@ -9,9 +9,12 @@
 #include "Hazel/Core/Layer.h"
 #include "Hazel/Core/Log.h"
 #include "Hazel/Core/MouseButtonCodes.h"
+#include "Hazel/Core/Random.h"
 #include "Hazel/Core/AssertionHandler.h"
 #include "Hazel/Core/Timestep.h"
 
+#include "Hazel/Debug/Instrumentor.h"
+
 #include "Hazel/ImGui/ImGuiLayer.h"
 #include "Hazel/OrthographicCameraController.h"
 
@@ -31,9 +34,13 @@
 #include "Hazel/Renderer/Renderer2D.h"
 #include "Hazel/Renderer/RendererAPI.h"
 #include "Hazel/Renderer/Shader.h"
+#include "Hazel/Renderer/StaticBatch.h"
 #include "Hazel/Renderer/VertexArray.h"
 #include "Hazel/Renderer/Texture.h"
 #include "Hazel/Renderer/SubTexture2D.h"
+#include "Hazel/Renderer/TextureAtlas.h"
+#include "Hazel/Renderer/Tilemap.h"
+#include "Hazel/Renderer/ParticleSystem.h"
 #include "Hazel/Renderer/Framebuffer.h"
 // -----------------------------------
 
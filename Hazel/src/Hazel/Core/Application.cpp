@@ -91,6 +91,7 @@ void Application::pushOverlay(std::unique_ptr<Layer> layer)
 void Application::run()
 {
     while (running_) {
+        HZ_PROFILE_FRAME();
         HZ_PROFILE_SCOPE("Application::run() loop");
         auto const time_delta{last_frame_time_.tick()};
 
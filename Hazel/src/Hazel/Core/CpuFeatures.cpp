@@ -0,0 +1,91 @@
+#include "CpuFeatures.h"
+
+#include <cstdint>
+
+#if HZ_ARCH_X86
+    #if defined(_MSC_VER)
+        #include <intrin.h>
+    #else
+        #include <cpuid.h>
+    #endif
+#endif
+
+namespace Hazel {
+
+namespace {
+#if HZ_ARCH_X86
+struct CpuidRegisters {
+    std::uint32_t eax{0};
+    std::uint32_t ebx{0};
+    std::uint32_t ecx{0};
+    std::uint32_t edx{0};
+};
+
+CpuidRegisters cpuid(std::uint32_t leaf, std::uint32_t subleaf = 0) noexcept
+{
+    CpuidRegisters regs{};
+    #if defined(_MSC_VER)
+    int info[4]{};
+    __cpuidex(info, static_cast<int>(leaf), static_cast<int>(subleaf));
+    regs.eax = static_cast<std::uint32_t>(info[0]);
+    regs.ebx = static_cast<std::uint32_t>(info[1]);
+    regs.ecx = static_cast<std::uint32_t>(info[2]);
+    regs.edx = static_cast<std::uint32_t>(info[3]);
+    #else
+    __cpuid_count(leaf, subleaf, regs.eax, regs.ebx, regs.ecx, regs.edx);
+    #endif
+    return regs;
+}
+
+std::uint64_t xgetbv(std::uint32_t index) noexcept
+{
+    #if defined(_MSC_VER)
+    return _xgetbv(index);
+    #else
+    std::uint32_t eax{0};
+    std::uint32_t edx{0};
+    __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(index));
+    return (static_cast<std::uint64_t>(edx) << 32) | eax;
+    #endif
+}
+
+constexpr bool bit(std::uint32_t reg, unsigned index) noexcept { return (reg >> index) & 1u; }
+
+CpuFeatures detect() noexcept
+{
+    CpuFeatures features{};
+
+    auto const max_leaf{cpuid(0).eax};
+    if (max_leaf < 1) {
+        return features;
+    }
+
+    auto const leaf1{cpuid(1)};
+    features.sse2 = bit(leaf1.edx, 26);
+    features.sse41 = bit(leaf1.ecx, 19);
+
+    // AVX registers are only usable if the OS saves both the XMM and YMM state on context switches
+    auto const os_saves_ymm{bit(leaf1.ecx, 27) && (xgetbv(0) & 0x6) == 0x6};
+    features.avx = bit(leaf1.ecx, 28) && os_saves_ymm;
+    features.fma = bit(leaf1.ecx, 12) && features.avx;
+    if (max_leaf >= 7) {
+        features.avx2 = bit(cpuid(7).ebx, 5) && features.avx;
+    }
+
+    if (cpuid(0x80000000).eax >= 0x80000007) {
+        features.invariant_tsc = bit(cpuid(0x80000007).edx, 8);
+    }
+    return features;
+}
+#else
+CpuFeatures detect() noexcept { return CpuFeatures{}; }
+#endif
+}  // namespace
+
+CpuFeatures const& CpuFeatures::get() noexcept
+{
+    static const CpuFeatures features{detect()};
+    return features;
+}
+
+}  // namespace Hazel
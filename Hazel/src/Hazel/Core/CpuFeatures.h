@@ -0,0 +1,22 @@
+#pragma once
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+    #define HZ_ARCH_X86 1
+#endif
+
+namespace Hazel {
+
+// Instruction set extensions and CPU properties detected at runtime through CPUID.
+// On non-x86 targets every feature is reported as unavailable.
+struct CpuFeatures {
+    bool sse2{false};
+    bool sse41{false};
+    bool avx{false};  // also requires the OS to save the YMM state
+    bool avx2{false};
+    bool fma{false};
+    bool invariant_tsc{false};
+
+    static CpuFeatures const& get() noexcept;
+};
+
+}  // namespace Hazel
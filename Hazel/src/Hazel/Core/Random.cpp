@@ -0,0 +1,116 @@
+#include "Random.h"
+
+#include <atomic>
+
+#include "Hazel/Core/CpuFeatures.h"
+
+#if HZ_ARCH_X86
+    #include <emmintrin.h>
+#endif
+
+namespace Hazel {
+
+namespace {
+constexpr const float float_unit{1.0f / 16777216.0f};  // 2^-24 - floats are made from the upper 24 bits
+
+std::atomic<std::uint64_t> s_thread_seed{0};
+std::atomic<std::uint64_t> s_next_thread_stream{0};
+
+// Expands the seed into the generator states - xoshiro must not start from an all-zero state, which splitmix64
+// never produces for four consecutive outputs
+std::uint64_t splitmix64(std::uint64_t& x) noexcept
+{
+    auto z{x += 0x9E3779B97F4A7C15ull};
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+constexpr std::uint32_t rotl(std::uint32_t x, int k) noexcept { return (x << k) | (x >> (32 - k)); }
+
+// xoshiro128+ step: returns the output for the current state and advances it
+inline std::uint32_t next(std::uint32_t& s0, std::uint32_t& s1, std::uint32_t& s2, std::uint32_t& s3) noexcept
+{
+    auto const result{s0 + s3};
+    auto const t{s1 << 9};
+    s2 ^= s0;
+    s3 ^= s1;
+    s1 ^= s2;
+    s0 ^= s3;
+    s2 ^= t;
+    s3 = rotl(s3, 11);
+    return result;
+}
+
+inline float to_float(std::uint32_t x) noexcept { return static_cast<float>(x >> 8) * float_unit; }
+}  // namespace
+
+Random::Random(std::uint64_t seed, std::uint64_t stream) noexcept { this->seed(seed, stream); }
+
+void Random::seed(std::uint64_t seed, std::uint64_t stream) noexcept
+{
+    auto stream_mix{stream};
+    auto x{seed ^ splitmix64(stream_mix)};
+    for (std::size_t i{0}; i != state_.size(); i += 2) {
+        auto const bits{splitmix64(x)};
+        state_[i] = static_cast<std::uint32_t>(bits);
+        state_[i + 1] = static_cast<std::uint32_t>(bits >> 32);
+    }
+    for (std::size_t i{0}; i != lanes_.size(); i += 2) {
+        auto const bits{splitmix64(x)};
+        lanes_[i] = static_cast<std::uint32_t>(bits);
+        lanes_[i + 1] = static_cast<std::uint32_t>(bits >> 32);
+    }
+}
+
+std::uint32_t Random::nextUInt() noexcept { return next(state_[0], state_[1], state_[2], state_[3]); }
+
+float Random::nextFloat() noexcept { return to_float(nextUInt()); }
+
+void Random::fill(float* values, std::size_t count) noexcept
+{
+    std::size_t i{0};
+#if HZ_ARCH_X86
+    auto s0{_mm_load_si128(reinterpret_cast<const __m128i*>(&lanes_[0]))};
+    auto s1{_mm_load_si128(reinterpret_cast<const __m128i*>(&lanes_[4]))};
+    auto s2{_mm_load_si128(reinterpret_cast<const __m128i*>(&lanes_[8]))};
+    auto s3{_mm_load_si128(reinterpret_cast<const __m128i*>(&lanes_[12]))};
+    auto const unit{_mm_set1_ps(float_unit)};
+    for (; i + 4 <= count; i += 4) {
+        auto const result{_mm_add_epi32(s0, s3)};
+        auto const t{_mm_slli_epi32(s1, 9)};
+        s2 = _mm_xor_si128(s2, s0);
+        s3 = _mm_xor_si128(s3, s1);
+        s1 = _mm_xor_si128(s1, s2);
+        s0 = _mm_xor_si128(s0, s3);
+        s2 = _mm_xor_si128(s2, t);
+        s3 = _mm_or_si128(_mm_slli_epi32(s3, 11), _mm_srli_epi32(s3, 21));
+        _mm_storeu_ps(values + i, _mm_mul_ps(_mm_cvtepi32_ps(_mm_srli_epi32(result, 8)), unit));
+    }
+    _mm_store_si128(reinterpret_cast<__m128i*>(&lanes_[0]), s0);
+    _mm_store_si128(reinterpret_cast<__m128i*>(&lanes_[4]), s1);
+    _mm_store_si128(reinterpret_cast<__m128i*>(&lanes_[8]), s2);
+    _mm_store_si128(reinterpret_cast<__m128i*>(&lanes_[12]), s3);
+#endif
+    // The remaining values - or all of them without SSE2 - from the same lanes, one group of 4 at a time. The values
+    // of the last, partial group that aren't needed are dropped.
+    for (; i < count; i += 4) {
+        for (std::size_t lane{0}; lane != 4; ++lane) {
+            auto const value{next(lanes_[lane], lanes_[4 + lane], lanes_[8 + lane], lanes_[12 + lane])};
+            if (i + lane < count) {
+                values[i + lane] = to_float(value);
+            }
+        }
+    }
+}
+
+Random& Random::get() noexcept
+{
+    thread_local Random random{s_thread_seed.load(std::memory_order_relaxed),
+                               s_next_thread_stream.fetch_add(1, std::memory_order_relaxed)};
+    return random;
+}
+
+void Random::setThreadSeed(std::uint64_t seed) noexcept { s_thread_seed.store(seed, std::memory_order_relaxed); }
+
+}  // namespace Hazel
@@ -0,0 +1,121 @@
+#include "ThreadPool.h"
+
+#include <algorithm>
+#include <chrono>
+
+namespace Hazel {
+
+namespace {
+// How long an idle worker polls for the next loop before it blocks
+constexpr const std::chrono::microseconds idle_spin_time{50};
+// Chunks per thread - more than one, so that threads finishing early pick up the slack of slower ones
+constexpr const std::size_t chunks_per_thread{4};
+
+constexpr std::uint32_t loop_tag(std::uint64_t next_chunk) noexcept
+{
+    return static_cast<std::uint32_t>(next_chunk >> 32);
+}
+
+constexpr std::uint32_t chunk_index(std::uint64_t next_chunk) noexcept
+{
+    return static_cast<std::uint32_t>(next_chunk);
+}
+}  // namespace
+
+ThreadPool::ThreadPool(std::uint32_t worker_count)
+{
+    workers_.reserve(worker_count);
+    for (std::uint32_t i{0}; i != worker_count; ++i) {
+        workers_.emplace_back([this] { workerMain(); });
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard lock{mutex_};
+        stopping_ = true;
+        generation_.fetch_add(1, std::memory_order_release);
+    }
+    wake_.notify_all();
+    for (auto& worker : workers_) {
+        worker.join();
+    }
+}
+
+void ThreadPool::parallelFor(std::size_t count, std::size_t min_chunk_size, const RangeFunction& function)
+{
+    if (count == 0) {
+        return;
+    }
+
+    auto const max_chunks{(workers_.size() + 1) * chunks_per_thread};
+    auto const chunk_size{std::max({min_chunk_size, (count + max_chunks - 1) / max_chunks, std::size_t{1}})};
+    auto const chunk_count{static_cast<std::uint32_t>((count + chunk_size - 1) / chunk_size)};
+    if (workers_.empty() || chunk_count == 1) {
+        function(0, count);
+        return;
+    }
+
+    Loop const loop{&function, count, chunk_size, chunk_count};
+    std::uint32_t tag;
+    {
+        std::lock_guard lock{mutex_};
+        loop_ = loop;
+        tag = generation_.load(std::memory_order_relaxed) + 1;
+        chunks_done_.store(0, std::memory_order_relaxed);
+        next_chunk_.store(std::uint64_t{tag} << 32, std::memory_order_relaxed);
+        generation_.store(tag, std::memory_order_release);
+    }
+    wake_.notify_all();
+
+    runChunks(loop, tag);
+    // Chunks claimed by workers are still running - they are short, so yielding beats blocking
+    while (chunks_done_.load(std::memory_order_acquire) != chunk_count) {
+        std::this_thread::yield();
+    }
+}
+
+void ThreadPool::workerMain()
+{
+    std::uint32_t seen{0};
+    for (;;) {
+        auto const spin_deadline{std::chrono::steady_clock::now() + idle_spin_time};
+        while (generation_.load(std::memory_order_acquire) == seen &&
+               std::chrono::steady_clock::now() < spin_deadline) {
+            std::this_thread::yield();
+        }
+
+        Loop loop;
+        {
+            std::unique_lock lock{mutex_};
+            wake_.wait(lock, [&] { return generation_.load(std::memory_order_relaxed) != seen; });
+            if (stopping_) {
+                return;
+            }
+            seen = generation_.load(std::memory_order_relaxed);
+            loop = loop_;
+        }
+        runChunks(loop, seen);
+    }
+}
+
+void ThreadPool::runChunks(const Loop& loop, std::uint32_t tag) noexcept
+{
+    auto next{next_chunk_.load(std::memory_order_relaxed)};
+    for (;;) {
+        if (loop_tag(next) != tag || chunk_index(next) >= loop.chunk_count) {
+            return;
+        }
+        if (!next_chunk_.compare_exchange_weak(next, next + 1, std::memory_order_acquire, std::memory_order_relaxed)) {
+            continue;
+        }
+
+        auto const begin{chunk_index(next) * loop.chunk_size};
+        (*loop.function)(begin, std::min(begin + loop.chunk_size, loop.count));
+        chunks_done_.fetch_add(1, std::memory_order_release);
+        next = next_chunk_.load(std::memory_order_relaxed);
+    }
+}
+
+}  // namespace Hazel
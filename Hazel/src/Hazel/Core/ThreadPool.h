@@ -0,0 +1,60 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Hazel {
+
+// Fixed set of worker threads for data-parallel loops. The calling thread takes part in every loop, so a pool with
+// N workers runs a loop on up to N + 1 threads.
+// Workers spin for a short while after a loop before going to sleep - consecutive loops within a frame don't pay
+// for waking them up again.
+class ThreadPool {
+public:
+    // Called with a half-open range [begin, end) of the loop's indices - must not throw
+    using RangeFunction = std::function<void(std::size_t begin, std::size_t end)>;
+
+    explicit ThreadPool(std::uint32_t worker_count);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    std::uint32_t getWorkerCount() const noexcept { return static_cast<std::uint32_t>(workers_.size()); }
+
+    // Splits [0, count) into chunks of at least `min_chunk_size` indices and runs `function` on them in parallel.
+    // Returns once every chunk is done. Not reentrant - only one thread at a time may start loops.
+    void parallelFor(std::size_t count, std::size_t min_chunk_size, const RangeFunction& function);
+
+private:
+    struct Loop {
+        const RangeFunction* function{nullptr};
+        std::size_t count{0};
+        std::size_t chunk_size{0};
+        std::uint32_t chunk_count{0};
+    };
+
+    void workerMain();
+    void runChunks(const Loop& loop, std::uint32_t tag) noexcept;
+
+    std::vector<std::thread> workers_;
+
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    bool stopping_{false};  // guarded by mutex_
+    Loop loop_;             // guarded by mutex_
+    std::atomic<std::uint32_t> generation_{0};
+
+    // Tag of the current loop in the high 32 bits, index of the next unclaimed chunk in the low ones - a worker
+    // that is late for a loop can't claim a chunk of the next one with stale parameters
+    std::atomic<std::uint64_t> next_chunk_{0};
+    std::atomic<std::uint32_t> chunks_done_{0};
+};
+
+}  // namespace Hazel
@@ -0,0 +1,57 @@
+#include "AllocationTracker.h"
+
+#if HZ_ENABLE_ALLOCATION_TRACKING
+
+    #include <cstdlib>
+    #include <new>
+
+namespace {
+// Every replacement operator new and delete goes through this pair. Calling malloc and free directly from the
+// operators makes GCC pair them up and report the free as -Wmismatched-new-delete.
+void* allocate(std::size_t size)
+{
+    auto& counters{Hazel::threadAllocationCounters()};
+    ++counters.count;
+    counters.bytes += size;
+
+    if (size == 0) {
+        size = 1;
+    }
+    while (true) {
+        if (auto* memory{std::malloc(size)}) {
+            return memory;
+        }
+        auto const handler{std::get_new_handler()};
+        if (handler == nullptr) {
+            throw std::bad_alloc{};
+        }
+        handler();
+    }
+}
+
+void* allocate(std::size_t size, const std::nothrow_t&) noexcept
+{
+    try {
+        return allocate(size);
+    }
+    catch (...) {
+        return nullptr;
+    }
+}
+
+void deallocate(void* memory) noexcept { std::free(memory); }
+}  // namespace
+
+void* operator new(std::size_t size) { return allocate(size); }
+void* operator new[](std::size_t size) { return allocate(size); }
+void* operator new(std::size_t size, const std::nothrow_t& tag) noexcept { return allocate(size, tag); }
+void* operator new[](std::size_t size, const std::nothrow_t& tag) noexcept { return allocate(size, tag); }
+
+void operator delete(void* memory) noexcept { deallocate(memory); }
+void operator delete[](void* memory) noexcept { deallocate(memory); }
+void operator delete(void* memory, std::size_t) noexcept { deallocate(memory); }
+void operator delete[](void* memory, std::size_t) noexcept { deallocate(memory); }
+void operator delete(void* memory, const std::nothrow_t&) noexcept { deallocate(memory); }
+void operator delete[](void* memory, const std::nothrow_t&) noexcept { deallocate(memory); }
+
+#endif  // HZ_ENABLE_ALLOCATION_TRACKING
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <cstdint>
+
+namespace Hazel {
+
+struct AllocationCounters {
+    std::uint64_t count{0};
+    std::uint64_t bytes{0};
+};
+
+// Heap allocations made by the calling thread so far. Only counted in builds with HZ_ENABLE_ALLOCATION_TRACKING,
+// which replace the global operator new and delete - the aligned overloads aren't replaced, so aren't counted.
+inline AllocationCounters& threadAllocationCounters() noexcept
+{
+    thread_local AllocationCounters counters;
+    return counters;
+}
+
+}  // namespace Hazel
@@ -0,0 +1,78 @@
+#include "FlightRecorder.h"
+
+#include <algorithm>
+
+namespace Hazel {
+
+FlightRecorder::FlightRecorder(std::uint32_t frame_count, std::int64_t budget_ticks)
+    : budget_ticks_{budget_ticks}, frames_(std::max(frame_count, 1u))
+{
+}
+
+void FlightRecorder::addScope(std::uint32_t scope_id, std::int64_t start, std::int64_t end, std::uint32_t thread_id,
+                              AllocationCounters const& allocations)
+{
+    // Nothing to attribute the scope to before the first frame
+    if (marks_.empty()) {
+        return;
+    }
+    pending_.push_back(FlightRecorderEvent{start, end, scope_id, thread_id, allocations});
+}
+
+void FlightRecorder::addFrameMark(std::int64_t time, std::uint32_t thread_id)
+{
+    marks_.push_back(Mark{time, thread_id});
+}
+
+std::vector<FlightRecorderFrame const*> const& FlightRecorder::endPass()
+{
+    capture_.clear();
+    if (marks_before_pass_ >= 2) {
+        closeFrames(marks_before_pass_ - 1);
+
+        auto const size{static_cast<std::uint32_t>(frames_.size())};
+        auto const requested{capture_requested_.exchange(false, std::memory_order_relaxed)};
+        if ((requested || (over_budget_ && frame_count_ == size)) && frame_count_ != 0) {
+            for (auto i{size - frame_count_}; i != size; ++i) {
+                capture_.push_back(&frames_[(next_frame_ + i) % size]);
+            }
+            capture_over_budget_ = over_budget_;
+            // The next capture only contains frames that come after this one
+            frame_count_ = 0;
+            over_budget_ = false;
+        }
+    }
+    marks_before_pass_ = marks_.size();
+    return capture_;
+}
+
+void FlightRecorder::closeFrames(std::size_t count)
+{
+    std::sort(pending_.begin(), pending_.end(),
+              [](FlightRecorderEvent const& lhs, FlightRecorderEvent const& rhs) { return lhs.end < rhs.end; });
+    auto event{std::find_if(pending_.begin(), pending_.end(), [first_start = marks_.front().time](
+                                                                  FlightRecorderEvent const& e) {
+        return e.end >= first_start;
+    })};
+
+    auto const size{static_cast<std::uint32_t>(frames_.size())};
+    for (std::size_t i{0}; i != count; ++i) {
+        auto& frame{frames_[next_frame_]};
+        frame.start = marks_[i].time;
+        frame.end = marks_[i + 1].time;
+        frame.thread_id = marks_[i].thread_id;
+        frame.events.clear();
+        for (; event != pending_.end() && event->end < frame.end; ++event) {
+            frame.events.push_back(*event);
+        }
+
+        over_budget_ |= budget_ticks_ > 0 && frame.end - frame.start > budget_ticks_;
+        next_frame_ = (next_frame_ + 1) % size;
+        frame_count_ = std::min(frame_count_ + 1, size);
+    }
+
+    pending_.erase(pending_.begin(), event);
+    marks_.erase(marks_.begin(), marks_.begin() + static_cast<std::ptrdiff_t>(count));
+}
+
+}  // namespace Hazel
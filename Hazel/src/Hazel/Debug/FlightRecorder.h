@@ -0,0 +1,75 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+#include "Hazel/Debug/AllocationTracker.h"
+
+namespace Hazel {
+
+struct FlightRecorderEvent {
+    std::int64_t start;
+    std::int64_t end;
+    std::uint32_t scope_id;
+    std::uint32_t thread_id;
+    AllocationCounters allocations;
+};
+
+struct FlightRecorderFrame {
+    std::int64_t start{0};
+    std::int64_t end{0};
+    std::uint32_t thread_id{0};  // of the frame mark
+    std::vector<FlightRecorderEvent> events;
+};
+
+// Keeps the events of the last `frame_count` frames, built from the events drained by the Instrumentor's writer
+// thread, and hands them out for writing when a frame takes longer than the budget or a capture is requested. Frames
+// are delimited by HZ_PROFILE_FRAME marks the same way as for ProfileStats.
+//
+// A budget capture waits until all `frame_count` frames in memory came after the previous capture - the frames around
+// a spike are captured with it, and a budget exceeded every frame (e.g. by VSync) writes one capture per
+// `frame_count` frames rather than one per frame.
+class FlightRecorder {
+public:
+    // A budget of 0 only captures on request
+    FlightRecorder(std::uint32_t frame_count, std::int64_t budget_ticks);
+
+    // Only called from the thread draining the events
+    void addScope(std::uint32_t scope_id, std::int64_t start, std::int64_t end, std::uint32_t thread_id,
+                  AllocationCounters const& allocations);
+    void addFrameMark(std::int64_t time, std::uint32_t thread_id);
+    // Called after every pass over the rings. Returns the frames to write out, oldest first, once a capture has been
+    // triggered - otherwise, and after a capture was handed out, empty. Valid until the next call.
+    std::vector<FlightRecorderFrame const*> const& endPass();
+
+    // Captures the frames in memory at the end of the next drain pass that closes a frame. Safe to call from any
+    // thread.
+    void requestCapture() noexcept { capture_requested_.store(true, std::memory_order_relaxed); }
+    // Whether the capture handed out by the last endPass contains a frame over the budget
+    bool isOverBudget() const noexcept { return capture_over_budget_; }
+
+private:
+    struct Mark {
+        std::int64_t time;
+        std::uint32_t thread_id;
+    };
+
+    void closeFrames(std::size_t count);
+
+    std::int64_t budget_ticks_;
+
+    std::vector<FlightRecorderEvent> pending_;  // events of frames that aren't closed yet
+    std::vector<Mark> marks_;                   // starts of the frames that aren't closed yet
+    std::size_t marks_before_pass_{0};          // marks_ known when the current pass began
+
+    std::vector<FlightRecorderFrame> frames_;  // ring buffer, the newest frame at next_frame_ - 1
+    std::uint32_t next_frame_{0};
+    std::uint32_t frame_count_{0};  // frames kept since the last capture
+    bool over_budget_{false};       // one of those frames is over the budget
+    bool capture_over_budget_{false};
+    std::atomic<bool> capture_requested_{false};
+    std::vector<FlightRecorderFrame const*> capture_;
+};
+
+}  // namespace Hazel
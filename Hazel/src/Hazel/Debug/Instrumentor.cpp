@@ -0,0 +1,464 @@
+#include "Instrumentor.h"
+
+#include <algorithm>
+#include <cstdio>
+
+namespace Hazel {
+
+namespace {
+// How long the writer thread sleeps when it finds all rings empty
+constexpr const std::chrono::milliseconds writer_idle_time{2};
+
+// Formatted events are collected and written to the file in chunks of about this size
+constexpr const std::size_t output_buffer_flush_size{64 * 1024};
+}  // namespace
+
+ProfileScope::ProfileScope(const char* scope_name, const char* scope_file, std::uint32_t scope_line,
+                           const char* scope_category) noexcept
+    : name{scope_name}, file{scope_file}, line{scope_line}, category{scope_category}, id{0}
+{
+    id = Instrumentor::get().registerScope(*this);
+}
+
+Instrumentor::~Instrumentor()
+{
+    disableFlightRecorder();
+    disableLiveStats();
+    endSession();
+}
+
+void Instrumentor::beginSession(const std::string& name, const std::string& filepath)
+{
+    std::lock_guard<std::mutex> control_lock{control_mutex_};
+    endSessionLocked();
+
+    {
+        std::lock_guard<std::mutex> lock{drain_mutex_};
+        // Whatever is still in the rings predates the session - goes to the live statistics, if any
+        drain();
+
+        std::uint64_t dropped{0};
+        {
+            std::lock_guard<std::mutex> rings_lock{rings_mutex_};
+            for (auto const& ring : rings_) {
+                dropped += ring->getDroppedCount();
+            }
+        }
+        dropped_at_session_start_ = dropped;
+
+        output_stream_.open(filepath);
+        output_stream_ << "{\"otherData\": {\"name\":\"" << name << "\"},\"traceEvents\":[";
+        microseconds_per_tick_ = 1'000'000.0 / ProfileClock::getTicksPerSecond();
+        session_start_ = ProfileClock::now();
+        profile_count_ = 0;
+        session_allocations_.clear();
+        session_open_ = true;
+    }
+
+    updateWriter(true);
+}
+
+void Instrumentor::endSession()
+{
+    std::lock_guard<std::mutex> control_lock{control_mutex_};
+    endSessionLocked();
+}
+
+void Instrumentor::endSessionLocked()
+{
+    if (!session_open_) {
+        return;
+    }
+    updateWriter(live_stats_ || flight_recorder_);
+
+    std::lock_guard<std::mutex> lock{drain_mutex_};
+    drain();
+    flushOutput();
+    output_stream_ << "],";
+    writeScopeTable(output_stream_);
+    output_stream_ << "}";
+    output_stream_.close();
+    session_open_ = false;
+}
+
+bool Instrumentor::isSessionActive() const
+{
+    std::lock_guard<std::mutex> lock{control_mutex_};
+    return session_open_;
+}
+
+void Instrumentor::enableLiveStats(std::uint32_t window_frames)
+{
+    std::lock_guard<std::mutex> control_lock{control_mutex_};
+    {
+        std::lock_guard<std::mutex> lock{drain_mutex_};
+        live_stats_ = std::make_unique<ProfileStats>(window_frames, 1'000.0 / ProfileClock::getTicksPerSecond());
+    }
+    updateWriter(true);
+}
+
+void Instrumentor::disableLiveStats()
+{
+    std::lock_guard<std::mutex> control_lock{control_mutex_};
+    if (!live_stats_) {
+        return;
+    }
+    updateWriter(session_open_ || flight_recorder_);
+    std::lock_guard<std::mutex> lock{drain_mutex_};
+    live_stats_.reset();
+}
+
+bool Instrumentor::isLiveStatsEnabled() const
+{
+    std::lock_guard<std::mutex> lock{control_mutex_};
+    return live_stats_ != nullptr;
+}
+
+ProfileStatsSnapshot Instrumentor::getLiveStats() const
+{
+    // live_stats_ is only replaced with control_mutex_ held, and takes the snapshot under a lock of its own
+    std::lock_guard<std::mutex> control_lock{control_mutex_};
+    return live_stats_ ? live_stats_->getSnapshot() : ProfileStatsSnapshot{};
+}
+
+void Instrumentor::enableFlightRecorder(std::uint32_t frame_count, float budget_ms,
+                                        const std::string& filepath_prefix)
+{
+    std::lock_guard<std::mutex> control_lock{control_mutex_};
+    {
+        std::lock_guard<std::mutex> lock{drain_mutex_};
+        auto const ticks_per_second{ProfileClock::getTicksPerSecond()};
+        microseconds_per_tick_ = 1'000'000.0 / ticks_per_second;
+        flight_recorder_ = std::make_unique<FlightRecorder>(
+            frame_count, static_cast<std::int64_t>(static_cast<double>(budget_ms) / 1'000.0 * ticks_per_second));
+        capture_prefix_ = filepath_prefix;
+    }
+    updateWriter(true);
+}
+
+void Instrumentor::disableFlightRecorder()
+{
+    std::lock_guard<std::mutex> control_lock{control_mutex_};
+    if (!flight_recorder_) {
+        return;
+    }
+    updateWriter(session_open_ || live_stats_);
+    std::lock_guard<std::mutex> lock{drain_mutex_};
+    flight_recorder_.reset();
+}
+
+bool Instrumentor::isFlightRecorderEnabled() const
+{
+    std::lock_guard<std::mutex> lock{control_mutex_};
+    return flight_recorder_ != nullptr;
+}
+
+void Instrumentor::captureFlightRecorder()
+{
+    std::lock_guard<std::mutex> lock{control_mutex_};
+    if (flight_recorder_) {
+        flight_recorder_->requestCapture();
+    }
+}
+
+void Instrumentor::updateWriter(bool active)
+{
+    recording_.store(active, std::memory_order_release);
+    if (active) {
+        startWriter();
+    }
+    else {
+        stopWriter();
+    }
+}
+
+void Instrumentor::startWriter()
+{
+    if (writer_.joinable()) {
+        return;
+    }
+    writer_stopping_ = false;
+    writer_ = std::thread{[this] { writerMain(); }};
+}
+
+void Instrumentor::stopWriter()
+{
+    if (!writer_.joinable()) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock{writer_mutex_};
+        writer_stopping_ = true;
+    }
+    writer_wake_.notify_one();
+    writer_.join();
+}
+
+std::uint64_t Instrumentor::getDroppedEventCount() const
+{
+    std::lock_guard<std::mutex> lock{rings_mutex_};
+    std::uint64_t dropped{0};
+    for (auto const& ring : rings_) {
+        dropped += ring->getDroppedCount();
+    }
+    return dropped - dropped_at_session_start_;
+}
+
+std::uint32_t Instrumentor::registerScope(const ProfileScope& scope)
+{
+    std::lock_guard<std::mutex> lock{scopes_mutex_};
+    auto const id{static_cast<std::uint32_t>(scopes_.size())};
+    scopes_.push_back(scope);
+    scopes_.back().id = id;
+    return id;
+}
+
+ProfileScope Instrumentor::getScope(std::uint32_t id) const
+{
+    std::lock_guard<std::mutex> lock{scopes_mutex_};
+    return scopes_[id];
+}
+
+ProfileEventRing& Instrumentor::registerThread()
+{
+    std::lock_guard<std::mutex> lock{rings_mutex_};
+    auto const thread_id{static_cast<std::uint32_t>(rings_.size())};
+    rings_.push_back(std::make_unique<ProfileEventRing>(thread_id));
+    return *rings_.back();
+}
+
+void Instrumentor::writerMain()
+{
+    std::unique_lock<std::mutex> lock{writer_mutex_};
+    while (!writer_stopping_) {
+        lock.unlock();
+        std::uint64_t drained{0};
+        {
+            std::lock_guard<std::mutex> drain_lock{drain_mutex_};
+            drained = drain();
+        }
+        lock.lock();
+        if (drained == 0) {
+            writer_wake_.wait_for(lock, writer_idle_time, [this] { return writer_stopping_; });
+        }
+    }
+}
+
+std::uint64_t Instrumentor::drain()
+{
+    // Rings are only ever added, and never freed before the Instrumentor - the lock only guards the vector
+    std::vector<ProfileEventRing*> rings;
+    {
+        std::lock_guard<std::mutex> lock{rings_mutex_};
+        rings.reserve(rings_.size());
+        for (auto& ring : rings_) {
+            rings.push_back(ring.get());
+        }
+    }
+
+    auto const handle_scope{[this](std::uint32_t scope_id, std::int64_t start, std::int64_t end,
+                                   std::uint32_t thread_id, AllocationCounters const& allocations) {
+        if (live_stats_) {
+            live_stats_->addScope(scope_id, start, end, allocations);
+        }
+        if (flight_recorder_) {
+            flight_recorder_->addScope(scope_id, start, end, thread_id, allocations);
+        }
+        if (session_open_ && start >= session_start_) {
+            writeEvent(scope_id, start, end, thread_id, allocations);
+        }
+    }};
+
+    std::uint64_t drained{0};
+    for (auto* ring : rings) {
+        auto const thread_id{ring->getThreadId()};
+        // A scope is handled once its last event is seen - the events of a scope are always consumed in the same call.
+        // The pending scope is a copy, its slot may already be reused once consume returns.
+        ProfileEvent scope{};
+        bool scope_pending{false};
+        std::int64_t scope_end{0};
+        bool awaiting_end{false};
+        auto const flush_scope{[&](AllocationCounters const& allocations) {
+            if (scope_pending) {
+                handle_scope(scope.scope_id & ~ProfileEvent::long_scope_bit, scope.start, scope_end, thread_id,
+                             allocations);
+                scope_pending = false;
+            }
+        }};
+
+        drained += ring->consume([&](const ProfileEvent& event) {
+            if (awaiting_end) {
+                scope_end = event.start;
+                awaiting_end = false;
+                return;
+            }
+            if (event.scope_id == ProfileEvent::allocations_id) {
+                flush_scope(AllocationCounters{event.duration, static_cast<std::uint64_t>(event.start)});
+                return;
+            }
+            flush_scope(AllocationCounters{});
+
+            if (event.scope_id == ProfileEvent::frame_mark_id) {
+                if (live_stats_) {
+                    live_stats_->addFrameMark(event.start);
+                }
+                if (flight_recorder_) {
+                    flight_recorder_->addFrameMark(event.start, thread_id);
+                }
+                if (session_open_ && event.start >= session_start_) {
+                    writeFrameMark(event.start, thread_id);
+                }
+            }
+            else {
+                scope = event;
+                scope_pending = true;
+                scope_end = event.start + event.duration;
+                awaiting_end = (event.scope_id & ProfileEvent::long_scope_bit) != 0;
+            }
+        });
+        flush_scope(AllocationCounters{});
+    }
+    if (live_stats_) {
+        live_stats_->endPass();
+    }
+    if (flight_recorder_) {
+        if (auto const& capture{flight_recorder_->endPass()}; !capture.empty()) {
+            writeCapture(capture, flight_recorder_->isOverBudget());
+        }
+    }
+    if (session_open_ && drained == 0) {
+        flushOutput();
+    }
+    return drained;
+}
+
+void Instrumentor::writeEvent(std::uint32_t scope_id, std::int64_t start, std::int64_t end, std::uint32_t thread_id,
+                              AllocationCounters const& allocations)
+{
+    if (profile_count_++ > 0)
+        output_buffer_ += ',';
+    appendEvent(output_buffer_, scope_id, start, end, thread_id, allocations, session_start_);
+    if (allocations.count != 0) {
+        writeAllocationCounter(end, thread_id, allocations);
+    }
+
+    if (output_buffer_.size() >= output_buffer_flush_size) {
+        flushOutput();
+    }
+}
+
+void Instrumentor::writeFrameMark(std::int64_t time, std::uint32_t thread_id)
+{
+    if (profile_count_++ > 0)
+        output_buffer_ += ',';
+    appendFrameMark(output_buffer_, time, thread_id, session_start_);
+}
+
+void Instrumentor::writeAllocationCounter(std::int64_t time, std::uint32_t thread_id,
+                                          AllocationCounters const& allocations)
+{
+    if (thread_id >= session_allocations_.size()) {
+        session_allocations_.resize(thread_id + 1);
+    }
+    auto& total{session_allocations_[thread_id]};
+    total.count += allocations.count;
+    total.bytes += allocations.bytes;
+
+    char event[192];
+    std::snprintf(event, sizeof(event),
+                  ",{\"name\":\"Allocations\",\"id\":%u,\"ph\":\"C\",\"pid\":0,\"tid\":%u,\"ts\":%.3f,"
+                  "\"args\":{\"count\":%llu,\"bytes\":%llu}}",
+                  thread_id, thread_id, (time - session_start_) * microseconds_per_tick_,
+                  static_cast<unsigned long long>(total.count), static_cast<unsigned long long>(total.bytes));
+    output_buffer_ += event;
+}
+
+void Instrumentor::writeCapture(std::vector<FlightRecorderFrame const*> const& frames, bool over_budget)
+{
+    auto const origin{frames.front()->start};
+    std::string events;
+    for (auto const* frame : frames) {
+        if (!events.empty())
+            events += ',';
+        appendFrameMark(events, frame->start, frame->thread_id, origin);
+        for (auto const& event : frame->events) {
+            events += ',';
+            appendEvent(events, event.scope_id, event.start, event.end, event.thread_id, event.allocations, origin);
+        }
+    }
+
+    auto const index{capture_count_.fetch_add(1, std::memory_order_relaxed)};
+    std::ofstream file{capture_prefix_ + "-" + std::to_string(index) + ".json"};
+    file << "{\"otherData\": {\"name\":\"Flight recorder\",\"trigger\":\"" << (over_budget ? "budget" : "request")
+         << "\",\"frames\":" << frames.size() << "},\"traceEvents\":[";
+    file.write(events.data(), static_cast<std::streamsize>(events.size()));
+    file << "],";
+    writeScopeTable(file);
+    file << "}";
+}
+
+void Instrumentor::appendEvent(std::string& out, std::uint32_t scope_id, std::int64_t start, std::int64_t end,
+                               std::uint32_t thread_id, AllocationCounters const& allocations, std::int64_t origin)
+{
+    if (scope_id >= scope_fields_.size()) {
+        updateScopeFields();
+    }
+
+    char number[96];
+    out += scope_fields_[scope_id];
+    if (allocations.count != 0) {
+        std::snprintf(number, sizeof(number), "\"args\":{\"allocations\":%llu,\"allocated_bytes\":%llu},",
+                      static_cast<unsigned long long>(allocations.count),
+                      static_cast<unsigned long long>(allocations.bytes));
+        out += number;
+    }
+    std::snprintf(number, sizeof(number), "\"dur\":%.3f,\"ph\":\"X\",\"pid\":0,\"tid\":%u,\"ts\":%.3f}",
+                  (end - start) * microseconds_per_tick_, thread_id, (start - origin) * microseconds_per_tick_);
+    out += number;
+}
+
+void Instrumentor::appendFrameMark(std::string& out, std::int64_t time, std::uint32_t thread_id,
+                                   std::int64_t origin) const
+{
+    char event[128];
+    std::snprintf(event, sizeof(event), "{\"name\":\"Frame\",\"ph\":\"i\",\"s\":\"g\",\"pid\":0,\"tid\":%u,\"ts\":%.3f}",
+                  thread_id, (time - origin) * microseconds_per_tick_);
+    out += event;
+}
+
+void Instrumentor::updateScopeFields()
+{
+    std::lock_guard<std::mutex> lock{scopes_mutex_};
+    for (auto i{scope_fields_.size()}; i < scopes_.size(); ++i) {
+        std::string name{scopes_[i].name};
+        std::replace(name.begin(), name.end(), '"', '\'');
+        scope_fields_.push_back("{\"cat\":\"" + std::string{scopes_[i].category} + "\",\"name\":\"" + name + "\",");
+    }
+}
+
+void Instrumentor::writeScopeTable(std::ostream& out) const
+{
+    std::lock_guard<std::mutex> lock{scopes_mutex_};
+    out << "\"profileScopes\":[";
+    for (std::size_t i{0}; i != scopes_.size(); ++i) {
+        auto const& scope{scopes_[i]};
+        std::string name{scope.name};
+        std::replace(name.begin(), name.end(), '"', '\'');
+        std::string file{scope.file};
+        std::replace(file.begin(), file.end(), '\\', '/');
+        std::replace(file.begin(), file.end(), '"', '\'');
+        if (i > 0)
+            out << ",";
+        out << "{\"id\":" << i << ",\"name\":\"" << name << "\",\"file\":\"" << file << "\",\"line\":"
+            << scope.line << ",\"cat\":\"" << scope.category << "\"}";
+    }
+    out << "]";
+}
+
+void Instrumentor::flushOutput()
+{
+    output_stream_.write(output_buffer_.data(), static_cast<std::streamsize>(output_buffer_.size()));
+    output_buffer_.clear();
+}
+
+}  // namespace Hazel
@@ -5,7 +5,8 @@
 //
 // Instrumentor::get().beginSession("Session Name");        // Begin session
 // {
-//     InstrumentationTimer timer("Profiled Scope Name");   // Place code like this in scopes you'd like to include in
+//     static const ProfileScope scope{"Profiled Scope Name", __FILE__, __LINE__, "scope"};
+//     InstrumentationTimer timer(scope);                   // Place code like this in scopes you'd like to include in
 //     profiling
 //     // Code
 // }
@@ -14,95 +15,280 @@
 // You will probably want to macro-fy this, to switch on/off easily and use things like __FUNCSIG__ for the profile
 // name.
 //
+// Every thread records its events into a ring buffer of its own, without locks or allocations. A writer thread
+// drains the rings in the background and writes them out as Chrome trace JSON. Events recorded while the thread's
+// ring is full are dropped - see Instrumentor::getDroppedEventCount.
+//
+// Events carry raw ProfileClock ticks and the id of their ProfileScope, they are only converted to trace time and
+// names when written out. The scopes themselves are listed once, at the end of the session's file.
+//
 #pragma once
 
 #include <algorithm>
-#include <chrono>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
 #include <fstream>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <thread>
+#include <vector>
+
+#include "Hazel/Debug/AllocationTracker.h"
+#include "Hazel/Debug/FlightRecorder.h"
+#include "Hazel/Debug/ProfileClock.h"
+#include "Hazel/Debug/ProfileStats.h"
 
 namespace Hazel {
 
-struct ProfileResult {
-    std::string name;
-    long long start, end;
-    uint32_t thread_id;
-};
+// Describes a profiled call site. Created once per site, as a function-local static by the profiling macros -
+// events only refer to it by id.
+struct ProfileScope {
+    ProfileScope(const char* scope_name, const char* scope_file, std::uint32_t scope_line,
+                 const char* scope_category) noexcept;
 
-struct InstrumentationSession {
-    std::string name;
+    // Not copied - have to stay valid for the rest of the program, e.g. string literals
+    const char* name;
+    const char* file;
+    std::uint32_t line;
+    const char* category;
+    std::uint32_t id;
 };
 
-class Instrumentor {
-private:
-    InstrumentationSession* current_session_{nullptr};
-    std::ofstream output_stream_;
-    int profile_count_{0};
+struct ProfileEvent {
+    // Set in scope_id when the scope's duration doesn't fit - the end is then in `start` of the next event
+    static constexpr const std::uint32_t long_scope_bit{1u << 31};
+    // scope_id of the events recorded by Instrumentor::markFrame
+    static constexpr const std::uint32_t frame_mark_id{long_scope_bit - 1};
+    // scope_id of the event following a scope's when allocations were made in the scope - the bytes are in `start`,
+    // the count in `duration`
+    static constexpr const std::uint32_t allocations_id{long_scope_bit - 2};
+
+    std::int64_t start;
+    std::uint32_t scope_id;
+    std::uint32_t duration;
+};
+static_assert(sizeof(ProfileEvent) == 16, "ProfileEvent should stay 16 bytes");
 
+// Ring of events with a single producer - the thread recording the events - and a single consumer, the
+// Instrumentor's writer thread
+class ProfileEventRing {
 public:
-    void beginSession(const std::string& name, const std::string& filepath = "results.json")
+    static constexpr const std::uint64_t capacity{1u << 15};
+
+    explicit ProfileEventRing(std::uint32_t thread_id) noexcept : thread_id_{thread_id} {}
+
+    // Returns false, dropping the event, if the ring is full
+    bool push(std::uint32_t scope_id, std::int64_t start, std::int64_t end,
+              AllocationCounters const& allocations = {}) noexcept
     {
-        output_stream_.open(filepath);
-        writeHeader();
-        current_session_ = new InstrumentationSession{name};
+        auto const duration{end - start};
+        auto const is_long{duration > static_cast<std::int64_t>(UINT32_MAX)};
+        std::uint64_t const size{1u + (is_long ? 1u : 0u) + (allocations.count != 0 ? 1u : 0u)};
+
+        auto tail{tail_.load(std::memory_order_relaxed)};
+        if (tail + size - head_.load(std::memory_order_acquire) > capacity) {
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        if (is_long) {
+            events_[tail++ & (capacity - 1)] = ProfileEvent{start, scope_id | ProfileEvent::long_scope_bit, 0};
+            events_[tail++ & (capacity - 1)] = ProfileEvent{end, scope_id, 0};
+        }
+        else {
+            events_[tail++ & (capacity - 1)] = ProfileEvent{start, scope_id, static_cast<std::uint32_t>(duration)};
+        }
+        if (allocations.count != 0) {
+            events_[tail++ & (capacity - 1)] =
+                ProfileEvent{static_cast<std::int64_t>(allocations.bytes), ProfileEvent::allocations_id,
+                             static_cast<std::uint32_t>(std::min<std::uint64_t>(allocations.count, UINT32_MAX))};
+        }
+        // All events of a scope are published together
+        tail_.store(tail, std::memory_order_release);
+        return true;
     }
 
-    void endSession()
+    // Calls `function` with every event pushed so far, oldest first, and frees their slots. Returns the number of
+    // events consumed.
+    template <typename Function>
+    std::uint64_t consume(Function&& function)
     {
-        writeFooter();
-        output_stream_.close();
-        delete current_session_;
-        current_session_ = nullptr;
-        profile_count_ = 0;
+        auto const head{head_.load(std::memory_order_relaxed)};
+        auto const tail{tail_.load(std::memory_order_acquire)};
+        for (auto i{head}; i != tail; ++i) {
+            function(events_[i & (capacity - 1)]);
+        }
+        head_.store(tail, std::memory_order_release);
+        return tail - head;
     }
 
-    void writeProfile(const ProfileResult& result)
+    std::uint32_t getThreadId() const noexcept { return thread_id_; }
+    std::uint64_t getDroppedCount() const noexcept { return dropped_.load(std::memory_order_relaxed); }
+
+private:
+    std::array<ProfileEvent, capacity> events_;
+    // Written by different threads - kept on separate cache lines
+    alignas(64) std::atomic<std::uint64_t> head_{0};
+    alignas(64) std::atomic<std::uint64_t> tail_{0};
+    std::atomic<std::uint64_t> dropped_{0};
+    std::uint32_t thread_id_;
+};
+
+class Instrumentor {
+public:
+    Instrumentor() = default;
+    ~Instrumentor();
+    Instrumentor(const Instrumentor&) = delete;
+    Instrumentor& operator=(const Instrumentor&) = delete;
+
+    // Calibrates ProfileClock the first time it's called
+    void beginSession(const std::string& name, const std::string& filepath = "results.json");
+    // Waits for the writer thread to write out every recorded event, followed by the table of scopes
+    void endSession();
+    bool isSessionActive() const;
+
+    // Live mode - keeps rolling statistics of the last `window_frames` frames (see ProfileStats), with or without a
+    // session. Restarts the statistics if already enabled.
+    void enableLiveStats(std::uint32_t window_frames = 120);
+    void disableLiveStats();
+    bool isLiveStatsEnabled() const;
+    // Empty while live mode is disabled
+    ProfileStatsSnapshot getLiveStats() const;
+
+    // Flight recorder - keeps the events of the last `frame_count` frames in memory, with or without a session, and
+    // writes them to "<filepath_prefix>-<n>.json" when captureFlightRecorder is called, or once `frame_count` frames
+    // have been recorded since the last capture and one of them took longer than `budget_ms` (0 disables the budget).
+    // Restarts the recorder if already enabled.
+    void enableFlightRecorder(std::uint32_t frame_count = 120, float budget_ms = 0.0f,
+                              const std::string& filepath_prefix = "HazelCapture");
+    void disableFlightRecorder();
+    bool isFlightRecorderEnabled() const;
+    // Writes out the frames in memory once the current frame is over
+    void captureFlightRecorder();
+    // Captures written since the program started
+    std::uint32_t getFlightRecorderCaptureCount() const noexcept
     {
-        if (profile_count_++ > 0)
-            output_stream_ << ",";
-
-        std::string name = result.name;
-        std::replace(name.begin(), name.end(), '"', '\'');
-
-        output_stream_ << "{";
-        output_stream_ << "\"cat\":\"function\",";
-        output_stream_ << "\"dur\":" << (result.end - result.start) << ',';
-        output_stream_ << "\"name\":\"" << name << "\",";
-        output_stream_ << "\"ph\":\"X\",";
-        output_stream_ << "\"pid\":0,";
-        output_stream_ << "\"tid\":" << result.thread_id << ",";
-        output_stream_ << "\"ts\":" << result.start;
-        output_stream_ << "}";
-
-        output_stream_.flush();
+        return capture_count_.load(std::memory_order_relaxed);
     }
 
-    void writeHeader()
+    bool isRecording() const noexcept { return recording_.load(std::memory_order_relaxed); }
+
+    // Timestamps are ProfileClock ticks. Does nothing unless a session, live mode or the flight recorder is active.
+    void record(const ProfileScope& scope, std::int64_t start, std::int64_t end,
+                AllocationCounters const& allocations = {}) noexcept
     {
-        output_stream_ << "{\"otherData\": {},\"traceEvents\":[";
-        output_stream_.flush();
+        if (isRecording()) {
+            threadRing().push(scope.id, start, end, allocations);
+        }
     }
 
-    void writeFooter()
+    // Marks the start of a frame, for live mode and the flight recorder
+    void markFrame() noexcept
     {
-        output_stream_ << "]}";
-        output_stream_.flush();
+        if (isRecording()) {
+            auto const now{ProfileClock::now()};
+            threadRing().push(ProfileEvent::frame_mark_id, now, now);
+        }
     }
 
+    // Returns the id of the scope
+    std::uint32_t registerScope(const ProfileScope& scope);
+    ProfileScope getScope(std::uint32_t id) const;
+
+    // Events lost in the current (or the latest) session because a ring was full
+    std::uint64_t getDroppedEventCount() const;
+
     static Instrumentor& get()
     {
         static Instrumentor instance;
         return instance;
     }
+
+private:
+    ProfileEventRing& threadRing() noexcept
+    {
+        thread_local ProfileEventRing* ring{nullptr};
+        if (ring == nullptr) {
+            ring = &registerThread();
+        }
+        return *ring;
+    }
+
+    // Called once per thread, on its first event - the only time recording takes a lock
+    ProfileEventRing& registerThread();
+    void endSessionLocked();
+    // Starts or stops recording and the writer thread
+    void updateWriter(bool active);
+    void startWriter();
+    void stopWriter();
+    void writerMain();
+    // Hands the events in every ring to the session, the live statistics and the flight recorder, whichever are active
+    // - with none of them, the events are thrown away. Called with drain_mutex_ held. Returns the number of events
+    // drained.
+    std::uint64_t drain();
+    void writeEvent(std::uint32_t scope_id, std::int64_t start, std::int64_t end, std::uint32_t thread_id,
+                    AllocationCounters const& allocations);
+    void writeFrameMark(std::int64_t time, std::uint32_t thread_id);
+    // Counter track of every allocation the thread made in profiled scopes since the session began
+    void writeAllocationCounter(std::int64_t time, std::uint32_t thread_id, AllocationCounters const& allocations);
+    void writeCapture(std::vector<FlightRecorderFrame const*> const& frames, bool over_budget);
+    // Trace event JSON with timestamps relative to `origin`
+    void appendEvent(std::string& out, std::uint32_t scope_id, std::int64_t start, std::int64_t end,
+                     std::uint32_t thread_id, AllocationCounters const& allocations, std::int64_t origin);
+    void appendFrameMark(std::string& out, std::int64_t time, std::uint32_t thread_id, std::int64_t origin) const;
+    // Formats the fields of the scopes registered since the last call
+    void updateScopeFields();
+    void writeScopeTable(std::ostream& out) const;
+    void flushOutput();
+
+    std::atomic<bool> recording_{false};
+
+    mutable std::mutex rings_mutex_;
+    std::vector<std::unique_ptr<ProfileEventRing>> rings_;  // never shrinks, rings outlive their threads
+    std::uint64_t dropped_at_session_start_{0};
+
+    mutable std::mutex scopes_mutex_;
+    std::vector<ProfileScope> scopes_;  // indexed by id
+
+    // Serializes the session and live mode calls
+    mutable std::mutex control_mutex_;
+
+    // Changed with both control_mutex_ and drain_mutex_ held - either is enough to read them
+    mutable std::mutex drain_mutex_;
+    bool session_open_{false};
+    std::unique_ptr<ProfileStats> live_stats_;
+    std::unique_ptr<FlightRecorder> flight_recorder_;
+    std::string capture_prefix_;
+
+    // Only used while draining, with drain_mutex_ held
+    std::ofstream output_stream_;
+    std::int64_t session_start_{0};
+    double microseconds_per_tick_{0.0};
+    std::uint64_t profile_count_{0};
+    std::string output_buffer_;
+    std::vector<std::string> scope_fields_;  // a scope's "cat" and "name" JSON fields, indexed by id
+    std::vector<AllocationCounters> session_allocations_;  // indexed by thread id
+    std::atomic<std::uint32_t> capture_count_{0};
+
+    std::thread writer_;
+    std::mutex writer_mutex_;
+    std::condition_variable writer_wake_;
+    bool writer_stopping_{false};  // guarded by writer_mutex_
 };
 
 class InstrumentationTimer {
 public:
-    InstrumentationTimer(const char* name) : name_(name), stopped_(false)
+#if HZ_ENABLE_ALLOCATION_TRACKING
+    InstrumentationTimer(const ProfileScope& scope) noexcept
+        : scope_(scope), allocations_start_(threadAllocationCounters()), parent_(current()), start_(ProfileClock::now())
     {
-        start_timepoint_ = std::chrono::high_resolution_clock::now();
+        current() = this;
     }
+#else
+    InstrumentationTimer(const ProfileScope& scope) noexcept : scope_(scope), start_(ProfileClock::now()) {}
+#endif
 
     ~InstrumentationTimer()
     {
@@ -110,25 +296,46 @@ public:
             stop();
     }
 
-    void stop()
+    void stop() noexcept
     {
-        auto endTimepoint = std::chrono::high_resolution_clock::now();
-
-        long long start =
-            std::chrono::time_point_cast<std::chrono::microseconds>(start_timepoint_).time_since_epoch().count();
-        long long end =
-            std::chrono::time_point_cast<std::chrono::microseconds>(endTimepoint).time_since_epoch().count();
-
-        uint32_t threadID = std::hash<std::thread::id>{}(std::this_thread::get_id());
-        Instrumentor::get().writeProfile({name_, start, end, threadID});
-
+        auto const end{ProfileClock::now()};
+#if HZ_ENABLE_ALLOCATION_TRACKING
+        // Allocations are attributed to the innermost scope only - the ones made in nested scopes are left out
+        auto const& allocations{threadAllocationCounters()};
+        AllocationCounters const inclusive{allocations.count - allocations_start_.count,
+                                           allocations.bytes - allocations_start_.bytes};
+        if (parent_ != nullptr) {
+            parent_->nested_allocations_.count += inclusive.count;
+            parent_->nested_allocations_.bytes += inclusive.bytes;
+        }
+        current() = parent_;
+        Instrumentor::get().record(scope_, start_, end,
+                                   AllocationCounters{inclusive.count - nested_allocations_.count,
+                                                      inclusive.bytes - nested_allocations_.bytes});
+#else
+        Instrumentor::get().record(scope_, start_, end);
+#endif
         stopped_ = true;
     }
 
 private:
-    const char* name_;
-    std::chrono::time_point<std::chrono::high_resolution_clock> start_timepoint_;
-    bool stopped_;
+#if HZ_ENABLE_ALLOCATION_TRACKING
+    // Innermost running timer of the calling thread
+    static InstrumentationTimer*& current() noexcept
+    {
+        thread_local InstrumentationTimer* timer{nullptr};
+        return timer;
+    }
+#endif
+
+    const ProfileScope& scope_;
+#if HZ_ENABLE_ALLOCATION_TRACKING
+    AllocationCounters allocations_start_;
+    AllocationCounters nested_allocations_;
+    InstrumentationTimer* parent_;
+#endif
+    std::int64_t start_;
+    bool stopped_{false};
 };
 
 }  // namespace Hazel
@@ -139,12 +346,17 @@ private:
 
 #define HZ_PROFILE_BEGIN_SESSION(nAME, fILEPATH) ::Hazel::Instrumentor::get().beginSession(nAME, fILEPATH)
 #define HZ_PROFILE_END_SESSION() ::Hazel::Instrumentor::get().endSession()
-#define HZ_PROFILE_SCOPE(nAME) \
-    ::Hazel::InstrumentationTimer HZ_CONCATENATE(timer, __LINE__) { nAME }
-#define HZ_PROFILE_FUNCTION() HZ_PROFILE_SCOPE(__FUNCSIG__)
+#define HZ_PROFILE_SCOPE_CATEGORY(nAME, cATEGORY)                                                          \
+    static const ::Hazel::ProfileScope HZ_CONCATENATE(profile_scope, __LINE__){nAME, __FILE__, __LINE__, cATEGORY}; \
+    ::Hazel::InstrumentationTimer HZ_CONCATENATE(timer, __LINE__) { HZ_CONCATENATE(profile_scope, __LINE__) }
+#define HZ_PROFILE_SCOPE(nAME) HZ_PROFILE_SCOPE_CATEGORY(nAME, "scope")
+#define HZ_PROFILE_FUNCTION() HZ_PROFILE_SCOPE_CATEGORY(__FUNCSIG__, "function")
+#define HZ_PROFILE_FRAME() ::Hazel::Instrumentor::get().markFrame()
 #else
 #define HZ_PROFILE_BEGIN_SESSION(nAME, fILEPATH)
 #define HZ_PROFILE_END_SESSION()
+#define HZ_PROFILE_SCOPE_CATEGORY(nAME, cATEGORY)
 #define HZ_PROFILE_SCOPE(nAME)
 #define HZ_PROFILE_FUNCTION()
+#define HZ_PROFILE_FRAME()
 #endif  // HZ_ENABLE_INSTRUMENTATION
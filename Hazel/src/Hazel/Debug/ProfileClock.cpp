@@ -0,0 +1,34 @@
+#include "ProfileClock.h"
+
+#include <thread>
+
+namespace Hazel {
+
+namespace {
+constexpr const std::chrono::milliseconds calibration_time{10};
+
+double calibrate()
+{
+    if (!ProfileClock::usesTsc()) {
+        return 1'000'000'000.0;
+    }
+
+    // Both clocks are read back to back at each end, the TSC rate is their ratio over the whole interval
+    auto const steady_begin{std::chrono::steady_clock::now()};
+    auto const ticks_begin{ProfileClock::now()};
+    std::this_thread::sleep_for(calibration_time);
+    auto const steady_end{std::chrono::steady_clock::now()};
+    auto const ticks_end{ProfileClock::now()};
+
+    auto const seconds{std::chrono::duration<double>(steady_end - steady_begin).count()};
+    return static_cast<double>(ticks_end - ticks_begin) / seconds;
+}
+}  // namespace
+
+double ProfileClock::getTicksPerSecond()
+{
+    static const double ticks_per_second{calibrate()};
+    return ticks_per_second;
+}
+
+}  // namespace Hazel
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+#include "Hazel/Core/CpuFeatures.h"
+
+#if HZ_ARCH_X86
+    #if defined(_MSC_VER)
+        #include <intrin.h>
+    #else
+        #include <x86intrin.h>
+    #endif
+#endif
+
+namespace Hazel {
+
+// Timestamps for the profiler. Reads the CPU's time stamp counter where it ticks at a constant rate (invariant TSC
+// on x86), which costs a fraction of a steady_clock::now() call - otherwise falls back to steady_clock nanoseconds.
+// Ticks are only comparable with each other; getTicksPerSecond converts them.
+class ProfileClock {
+public:
+    static std::int64_t now() noexcept
+    {
+#if HZ_ARCH_X86
+        if (usesTsc()) {
+            return static_cast<std::int64_t>(__rdtsc());
+        }
+#endif
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+    }
+
+    static bool usesTsc() noexcept
+    {
+        static const bool uses_tsc{CpuFeatures::get().invariant_tsc};
+        return uses_tsc;
+    }
+
+    // Measured against steady_clock the first time it's called, which takes a few milliseconds
+    static double getTicksPerSecond();
+};
+
+}  // namespace Hazel
@@ -0,0 +1,139 @@
+#include "ProfileStats.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace Hazel {
+
+namespace {
+// Sorts `ticks`
+ProfileTimeStats compute_time_stats(std::vector<std::int64_t>& ticks, double milliseconds_per_tick)
+{
+    ProfileTimeStats stats{};
+    if (ticks.empty()) {
+        return stats;
+    }
+    std::sort(ticks.begin(), ticks.end());
+    double sum{0.0};
+    for (auto const t : ticks) {
+        sum += static_cast<double>(t);
+    }
+    auto const p99_index{static_cast<std::size_t>(std::ceil(0.99 * static_cast<double>(ticks.size()))) - 1};
+    stats.min_ms = static_cast<float>(ticks.front() * milliseconds_per_tick);
+    stats.avg_ms = static_cast<float>(sum / static_cast<double>(ticks.size()) * milliseconds_per_tick);
+    stats.max_ms = static_cast<float>(ticks.back() * milliseconds_per_tick);
+    stats.p99_ms = static_cast<float>(ticks[p99_index] * milliseconds_per_tick);
+    return stats;
+}
+}  // namespace
+
+ProfileStats::ProfileStats(std::uint32_t window_frames, double milliseconds_per_tick)
+    : window_frames_{std::max(window_frames, 1u)},
+      milliseconds_per_tick_{milliseconds_per_tick},
+      frame_ticks_(window_frames_, 0)
+{
+}
+
+void ProfileStats::addScope(std::uint32_t scope_id, std::int64_t start, std::int64_t end,
+                            AllocationCounters const& allocations)
+{
+    // Nothing to attribute the scope to before the first frame
+    if (marks_.empty()) {
+        return;
+    }
+    pending_.push_back(ScopeEnd{end, end - start, scope_id, allocations});
+}
+
+void ProfileStats::addFrameMark(std::int64_t time) { marks_.push_back(time); }
+
+void ProfileStats::endPass()
+{
+    if (marks_before_pass_ >= 2) {
+        closeFrames(marks_before_pass_ - 1);
+        publish();
+    }
+    marks_before_pass_ = marks_.size();
+}
+
+void ProfileStats::closeFrames(std::size_t count)
+{
+    std::sort(pending_.begin(), pending_.end(),
+              [](ScopeEnd const& lhs, ScopeEnd const& rhs) { return lhs.end < rhs.end; });
+    auto scope{std::find_if(pending_.begin(), pending_.end(),
+                            [first_start = marks_.front()](ScopeEnd const& s) { return s.end >= first_start; })};
+
+    for (std::size_t frame{0}; frame != count; ++frame) {
+        auto const frame_end{marks_[frame + 1]};
+        std::fill(closing_.begin(), closing_.end(), FrameTotal{});
+        for (; scope != pending_.end() && scope->end < frame_end; ++scope) {
+            if (scope->scope_id >= closing_.size()) {
+                closing_.resize(scope->scope_id + 1);
+            }
+            auto& total{closing_[scope->scope_id]};
+            total.ticks += scope->duration;
+            ++total.calls;
+            total.allocations.count += scope->allocations.count;
+            total.allocations.bytes += scope->allocations.bytes;
+        }
+
+        if (scope_totals_.size() < closing_.size()) {
+            scope_totals_.resize(closing_.size(), std::vector<FrameTotal>(window_frames_));
+        }
+        for (std::size_t id{0}; id != scope_totals_.size(); ++id) {
+            scope_totals_[id][window_next_] = id < closing_.size() ? closing_[id] : FrameTotal{};
+        }
+        frame_ticks_[window_next_] = frame_end - marks_[frame];
+        window_next_ = (window_next_ + 1) % window_frames_;
+        window_count_ = std::min(window_count_ + 1, window_frames_);
+    }
+
+    pending_.erase(pending_.begin(), scope);
+    marks_.erase(marks_.begin(), marks_.begin() + static_cast<std::ptrdiff_t>(count));
+}
+
+void ProfileStats::publish()
+{
+    // Until the window is full its frames are the first window_count_ entries
+    ProfileStatsSnapshot snapshot{};
+    snapshot.frame_count = window_count_;
+    sort_scratch_.assign(frame_ticks_.begin(), frame_ticks_.begin() + window_count_);
+    snapshot.frame_time = compute_time_stats(sort_scratch_, milliseconds_per_tick_);
+
+    for (std::size_t id{0}; id != scope_totals_.size(); ++id) {
+        sort_scratch_.clear();
+        std::uint64_t calls{0};
+        AllocationCounters allocations{};
+        for (std::uint32_t frame{0}; frame != window_count_; ++frame) {
+            auto const& total{scope_totals_[id][frame]};
+            if (total.calls != 0) {
+                sort_scratch_.push_back(total.ticks);
+                calls += total.calls;
+                allocations.count += total.allocations.count;
+                allocations.bytes += total.allocations.bytes;
+            }
+        }
+        if (calls == 0) {
+            continue;
+        }
+        auto const frames{static_cast<float>(window_count_)};
+        snapshot.scopes.push_back(ProfileScopeStats{
+            static_cast<std::uint32_t>(id), compute_time_stats(sort_scratch_, milliseconds_per_tick_),
+            static_cast<float>(calls) / frames, static_cast<float>(allocations.count) / frames,
+            static_cast<float>(allocations.bytes) / frames});
+    }
+    std::sort(snapshot.scopes.begin(), snapshot.scopes.end(),
+              [](ProfileScopeStats const& lhs, ProfileScopeStats const& rhs) {
+                  return lhs.time.avg_ms > rhs.time.avg_ms;
+              });
+
+    std::lock_guard<std::mutex> lock{snapshot_mutex_};
+    snapshot_ = std::move(snapshot);
+}
+
+ProfileStatsSnapshot ProfileStats::getSnapshot() const
+{
+    std::lock_guard<std::mutex> lock{snapshot_mutex_};
+    return snapshot_;
+}
+
+}  // namespace Hazel
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include "Hazel/Debug/AllocationTracker.h"
+
+namespace Hazel {
+
+struct ProfileTimeStats {
+    float min_ms{0.0f};
+    float avg_ms{0.0f};
+    float max_ms{0.0f};
+    float p99_ms{0.0f};
+};
+
+struct ProfileScopeStats {
+    std::uint32_t scope_id;  // see Instrumentor::getScope
+    ProfileTimeStats time;   // per frame, over the frames of the window the scope was entered in
+    float calls_per_frame;   // over every frame of the window
+    // Made in the scope itself rather than nested ones, over every frame of the window - only counted in builds with
+    // HZ_ENABLE_ALLOCATION_TRACKING
+    float allocations_per_frame;
+    float allocated_bytes_per_frame;
+};
+
+struct ProfileStatsSnapshot {
+    std::uint32_t frame_count{0};  // frames in the window so far
+    ProfileTimeStats frame_time;
+    std::vector<ProfileScopeStats> scopes;  // slowest average first
+};
+
+// Rolling per-scope statistics over the last `window_frames` frames, built from the events drained by the
+// Instrumentor's writer thread. Frames are delimited by HZ_PROFILE_FRAME marks; a scope counts towards the frame its
+// end falls in.
+class ProfileStats {
+public:
+    ProfileStats(std::uint32_t window_frames, double milliseconds_per_tick);
+
+    // Only called from the thread draining the events
+    void addScope(std::uint32_t scope_id, std::int64_t start, std::int64_t end, AllocationCounters const& allocations);
+    void addFrameMark(std::int64_t time);
+    // Called after every pass over the rings. Closes the frames that ended before the pass began, every ring has
+    // been drained past them by now.
+    void endPass();
+
+    std::uint32_t getWindowFrames() const noexcept { return window_frames_; }
+    // Safe to call from any thread
+    ProfileStatsSnapshot getSnapshot() const;
+
+private:
+    struct ScopeEnd {
+        std::int64_t end;
+        std::int64_t duration;
+        std::uint32_t scope_id;
+        AllocationCounters allocations;
+    };
+    struct FrameTotal {
+        std::int64_t ticks{0};
+        std::uint32_t calls{0};
+        AllocationCounters allocations;
+    };
+
+    void closeFrames(std::size_t count);
+    void publish();
+
+    std::uint32_t window_frames_;
+    double milliseconds_per_tick_;
+
+    std::vector<ScopeEnd> pending_;     // scopes of frames that aren't closed yet
+    std::vector<std::int64_t> marks_;   // starts of the frames that aren't closed yet
+    std::size_t marks_before_pass_{0};  // marks_ known when the current pass began
+
+    // Ring buffers of window_frames_ entries, the newest frame at window_next_ - 1
+    std::vector<std::int64_t> frame_ticks_;
+    std::vector<std::vector<FrameTotal>> scope_totals_;  // indexed by scope id
+    std::vector<FrameTotal> closing_;                     // totals of the frame being closed, indexed by scope id
+    std::uint32_t window_next_{0};
+    std::uint32_t window_count_{0};
+    std::vector<std::int64_t> sort_scratch_;
+
+    mutable std::mutex snapshot_mutex_;
+    ProfileStatsSnapshot snapshot_;
+};
+
+}  // namespace Hazel
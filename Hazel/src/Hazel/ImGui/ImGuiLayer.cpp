@@ -3,6 +3,8 @@
 #include <GLFW/glfw3.h>
 
 #include "Hazel/Core/Application.h"
+#include "Hazel/Core/KeyCodes.h"
+#include "Hazel/Debug/Instrumentor.h"
 #include "imgui/examples/imgui_impl_glfw.h"
 #include "imgui/examples/imgui_impl_opengl3.h"
 #include "imgui/imgui.h"
@@ -60,6 +62,16 @@ void ImGuiLayer::onEvent(Event& e) noexcept
     ImGuiIO& io = ImGui::GetIO();
     e.handled |= e.isInCategory(EventCategoryMouse) & io.WantCaptureMouse;
     e.handled |= e.isInCategory(EventCategoryKeyboard) & io.WantCaptureKeyboard;
+
+#if HZ_ENABLE_INSTRUMENTATION
+    EventDispatcher dispatcher{e};
+    dispatcher.dispatch<KeyPressedEvent>([](KeyPressedEvent& key) {
+        if (static_cast<KeyCode>(key.getKeyCode()) == KeyCode::F9) {
+            Instrumentor::get().captureFlightRecorder();
+        }
+        return key.handled;
+    });
+#endif
 }
 
 void ImGuiLayer::begin()
@@ -90,6 +102,105 @@ void ImGuiLayer::onImGuiRender()
 {
     // static bool show = true;
     // ImGui::ShowDemoWindow(&show);
+#if HZ_ENABLE_INSTRUMENTATION
+    drawProfilerPanel();
+#endif
+}
+
+void ImGuiLayer::drawProfilerPanel()
+{
+    auto& instrumentor{Instrumentor::get()};
+    ImGui::Begin("Profiler");
+
+    bool live{instrumentor.isLiveStatsEnabled()};
+    if (ImGui::Checkbox("Live stats", &live)) {
+        if (live) {
+            instrumentor.enableLiveStats(static_cast<std::uint32_t>(profiler_window_frames_));
+        }
+        else {
+            instrumentor.disableLiveStats();
+        }
+    }
+    if (ImGui::SliderInt("Window (frames)", &profiler_window_frames_, 10, 1000) && live) {
+        instrumentor.enableLiveStats(static_cast<std::uint32_t>(profiler_window_frames_));
+    }
+
+    if (live) {
+        auto const stats{instrumentor.getLiveStats()};
+        auto const& frame{stats.frame_time};
+        ImGui::Text("Frame time over %u frames (ms): min %.2f, avg %.2f, max %.2f, p99 %.2f", stats.frame_count,
+                    static_cast<double>(frame.min_ms), static_cast<double>(frame.avg_ms),
+                    static_cast<double>(frame.max_ms), static_cast<double>(frame.p99_ms));
+
+#if HZ_ENABLE_ALLOCATION_TRACKING
+        ImGui::Columns(8, "Profiler scopes");
+#else
+        ImGui::Columns(6, "Profiler scopes");
+#endif
+        ImGui::Text("Scope");
+        ImGui::NextColumn();
+        for (auto const* header : {"Min (ms)", "Avg (ms)", "Max (ms)", "P99 (ms)", "Calls/frame"}) {
+            ImGui::Text("%s", header);
+            ImGui::NextColumn();
+        }
+#if HZ_ENABLE_ALLOCATION_TRACKING
+        ImGui::Text("Allocs/frame");
+        ImGui::NextColumn();
+        ImGui::Text("KiB/frame");
+        ImGui::NextColumn();
+#endif
+        ImGui::Separator();
+        for (auto const& scope : stats.scopes) {
+            auto const descriptor{instrumentor.getScope(scope.scope_id)};
+            ImGui::Text("%s", descriptor.name);
+            if (ImGui::IsItemHovered()) {
+                ImGui::SetTooltip("%s:%u", descriptor.file, descriptor.line);
+            }
+            ImGui::NextColumn();
+            for (auto const value : {scope.time.min_ms, scope.time.avg_ms, scope.time.max_ms, scope.time.p99_ms}) {
+                ImGui::Text("%.3f", static_cast<double>(value));
+                ImGui::NextColumn();
+            }
+            ImGui::Text("%.1f", static_cast<double>(scope.calls_per_frame));
+            ImGui::NextColumn();
+#if HZ_ENABLE_ALLOCATION_TRACKING
+            ImGui::Text("%.1f", static_cast<double>(scope.allocations_per_frame));
+            ImGui::NextColumn();
+            ImGui::Text("%.2f", static_cast<double>(scope.allocated_bytes_per_frame) / 1024.0);
+            ImGui::NextColumn();
+#endif
+        }
+        ImGui::Columns(1);
+    }
+
+    ImGui::Separator();
+    auto const restart_recorder{[this, &instrumentor] {
+        instrumentor.enableFlightRecorder(static_cast<std::uint32_t>(flight_recorder_frames_),
+                                          flight_recorder_budget_ms_);
+    }};
+    bool recorder{instrumentor.isFlightRecorderEnabled()};
+    if (ImGui::Checkbox("Flight recorder", &recorder)) {
+        if (recorder) {
+            restart_recorder();
+        }
+        else {
+            instrumentor.disableFlightRecorder();
+        }
+    }
+    auto const frames_changed{ImGui::SliderInt("Recorded frames", &flight_recorder_frames_, 1, 600)};
+    auto const budget_changed{ImGui::SliderFloat("Frame budget (ms, 0 = off)", &flight_recorder_budget_ms_, 0.0f, 50.0f)};
+    if ((frames_changed || budget_changed) && recorder) {
+        restart_recorder();
+    }
+    if (recorder) {
+        if (ImGui::Button("Capture (F9)")) {
+            instrumentor.captureFlightRecorder();
+        }
+        ImGui::SameLine();
+        ImGui::Text("Captures written: %u", instrumentor.getFlightRecorderCaptureCount());
+    }
+
+    ImGui::End();
 }
 
 }  // namespace Hazel
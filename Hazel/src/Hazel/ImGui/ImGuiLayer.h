@@ -22,7 +22,13 @@ public:
     void end();
 
 private:
+    // Rolling per-scope timings from Instrumentor's live mode, and the flight recorder controls
+    void drawProfilerPanel();
+
     float time_{0.0f};
+    int profiler_window_frames_{120};
+    int flight_recorder_frames_{60};
+    float flight_recorder_budget_ms_{0.0f};  // captures on request only
 };
 
 }  // namespace Hazel
@@ -3,6 +3,7 @@
 #include "Renderer.h"
 
 #include "Hazel/Core/AssertionHandler.h"
+#include "Platform/Null/NullBuffer.h"
 #include "Platform/OpenGL/OpenGLBuffer.h"
 
 namespace Hazel {
@@ -16,6 +17,8 @@ Scope<VertexBuffer> VertexBuffer::create(std::uint32_t size)
         //           "RendererAPI::API::None is currently not supported");
     case RendererAPI::API::OpenGL:
         return std::make_unique<OpenGLVertexBuffer>(size);
+    case RendererAPI::API::Null:
+        return std::make_unique<NullVertexBuffer>(size);
     default:
         HZ_ASSERT(false, "Unknown RendererAPI::API");
         // HZ_EXPECTS(false, DefaultCoreHandler, Hazel::Enforce, "Unknown RendererAPI::API");
@@ -32,6 +35,25 @@ Scope<VertexBuffer> VertexBuffer::create(const float* vertices, std::uint32_t si
                   "RendererAPI::API::None is currently not supported");
     case RendererAPI::API::OpenGL:
         return std::make_unique<OpenGLVertexBuffer>(vertices, size);
+    case RendererAPI::API::Null:
+        return std::make_unique<NullVertexBuffer>(vertices, size);
+    default:
+        HZ_EXPECTS(false, DefaultCoreHandler, Hazel::Enforce, "Unknown RendererAPI::API");
+    }
+
+    return nullptr;
+}
+
+Scope<StreamingVertexBuffer> StreamingVertexBuffer::create(std::uint32_t region_size, std::uint32_t region_count)
+{
+    switch (Renderer::getApi()) {
+    case RendererAPI::API::None:
+        HZ_EXPECTS(false, DefaultCoreHandler, Hazel::Enforce,
+                  "RendererAPI::API::None is currently not supported");
+    case RendererAPI::API::OpenGL:
+        return std::make_unique<OpenGLStreamingVertexBuffer>(region_size, region_count);
+    case RendererAPI::API::Null:
+        return std::make_unique<NullStreamingVertexBuffer>(region_size, region_count);
     default:
         HZ_EXPECTS(false, DefaultCoreHandler, Hazel::Enforce, "Unknown RendererAPI::API");
     }
@@ -47,6 +69,8 @@ Scope<IndexBuffer> IndexBuffer::create(const std::uint32_t* indices, std::uint32
                   "RendererAPI::API::None is currently not supported");
     case RendererAPI::API::OpenGL:
         return std::make_unique<OpenGLIndexBuffer>(indices, size);
+    case RendererAPI::API::Null:
+        return std::make_unique<NullIndexBuffer>(indices, size);
     default:
         HZ_EXPECTS(false, DefaultCoreHandler, Hazel::Enforce, "Unknown RendererAPI::API");
     }
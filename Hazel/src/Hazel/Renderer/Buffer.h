@@ -20,6 +20,8 @@ enum class ShaderDataType {
     Int2,
     Int3,
     Int4,
+    UByte4,   // four 8-bit components - read as a vec4 in [0, 1] when the element is normalized
+    UShort2,  // two 16-bit components - read as a vec2 in [0, 1] when the element is normalized
     Bool,
 };
 
@@ -38,6 +40,8 @@ constexpr std::uint32_t shaderDataTypeSize(ShaderDataType type) noexcept
         case ShaderDataType::Int2  :    return sizeof(unsigned int) * 2;
         case ShaderDataType::Int3  :    return sizeof(unsigned int) * 3;
         case ShaderDataType::Int4  :    return sizeof(unsigned int) * 4;
+        case ShaderDataType::UByte4:    return sizeof(std::uint8_t) * 4;
+        case ShaderDataType::UShort2:   return sizeof(std::uint16_t) * 2;
         case ShaderDataType::Bool  :    return sizeof(bool);
     }
     // clang-format on
@@ -69,6 +73,8 @@ constexpr std::uint32_t componentCount(ShaderDataType type) noexcept
         case ShaderDataType::Int2  :    return 2;
         case ShaderDataType::Int3  :    return 3;
         case ShaderDataType::Int4  :    return 4;
+        case ShaderDataType::UByte4:    return 4;
+        case ShaderDataType::UShort2:   return 2;
         case ShaderDataType::Bool  :    return 1;
     }
     // clang-format on
@@ -89,7 +95,7 @@ struct BufferElement {
               typename = std::enable_if_t<!std::is_same_v<std::decay_t<StringT>, BufferElement> &&
                                           std::is_convertible_v<StringT, std::string>>>
     BufferElement(ShaderDataType type_, StringT&& name_, bool normalized_)
-        : BufferElement{type_, std::forward<StringT>(name_)}, normalized{normalized_}
+        : name{std::forward<StringT>(name_)}, type{type_}, size{shaderDataTypeSize(type)}, normalized{normalized_}
     {
     }
 
@@ -107,6 +113,12 @@ struct BufferElement {
     bool normalized{false};
 };
 
+// Rate at which the attributes of a BufferLayout advance while drawing
+enum class VertexStepRate {
+    PerVertex,
+    PerInstance,  // advanced once per instance of an instanced draw call
+};
+
 class BufferLayout {
 public:
     using value_type = BufferElement;
@@ -115,7 +127,8 @@ public:
     using iterator = typename std::vector<value_type>::iterator;
     using const_iterator = typename std::vector<value_type>::const_iterator;
 
-    BufferLayout(std::initializer_list<BufferElement> elements) : elements_(std::move(elements))
+    BufferLayout(std::initializer_list<BufferElement> elements, VertexStepRate step_rate = VertexStepRate::PerVertex)
+        : elements_(std::move(elements)), step_rate_{step_rate}
     {
         calculateOffsetAndStride();
     }
@@ -129,6 +142,7 @@ public:
 
     inline const std::vector<BufferElement>& getElements() const noexcept { return elements_; }
     inline auto getStride() const noexcept { return stride_; }
+    inline VertexStepRate getStepRate() const noexcept { return step_rate_; }
 
     iterator begin() noexcept { return elements_.begin(); }
     iterator end() noexcept { return elements_.end(); }
@@ -151,6 +165,7 @@ private:
 
     std::vector<BufferElement> elements_;
     std::uint32_t stride_{0};
+    VertexStepRate step_rate_{VertexStepRate::PerVertex};
 };
 
 class VertexBuffer {
@@ -187,6 +202,29 @@ public:
     virtual void unbind() const = 0;
 };
 
+// Vertex buffer the CPU writes into directly, without an intermediate copy.
+// The storage is split into `region_count` equally sized regions which are used round-robin, so that the
+// region being written is never one the GPU may still be reading from. Per batch of vertices:
+//   auto* data{buffer.map()};  // only waits if the GPU has not finished reading this region yet
+//   ...write at most getRegionSize() bytes...
+//   buffer.commit(size);       // makes the written bytes visible to the GPU
+//   ...draw, offsetting the vertices by getRegionOffset() / stride...
+//   buffer.advance();          // fences the region and moves on to the next one
+class StreamingVertexBuffer : public VertexBuffer {
+public:
+    static constexpr const std::uint32_t default_region_count{3};
+
+    static Scope<StreamingVertexBuffer> create(std::uint32_t region_size,
+                                               std::uint32_t region_count = default_region_count);
+
+    virtual void* map() = 0;
+    virtual void commit(std::uint32_t size) = 0;
+    virtual void advance() = 0;
+
+    virtual std::uint32_t getRegionSize() const noexcept = 0;
+    virtual std::uint32_t getRegionOffset() const noexcept = 0;
+};
+
 
 // Currently only 32-bit index buffers are supported
 class IndexBuffer {
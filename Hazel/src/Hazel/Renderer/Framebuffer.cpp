@@ -1,6 +1,7 @@
 #include "Framebuffer.h"
 
 #include "Hazel/Renderer/Renderer.h"
+#include "Platform/Null/NullFramebuffer.h"
 #include "Platform/OpenGL/OpenGLFramebuffer.h"
 
 namespace Hazel {
@@ -12,6 +13,8 @@ Ref<Framebuffer> Framebuffer::create(FramebufferSpecification const& spec)
         HZ_ASSERT(false, "RendererAPI::API::None is currently not supported");
     case RendererAPI::API::OpenGL:
         return makeRef<OpenGLFramebuffer>(spec);
+    case RendererAPI::API::Null:
+        return makeRef<NullFramebuffer>(spec);
     default:
         HZ_ASSERT(false, "Unknown RendererAPI::API");
     }
@@ -0,0 +1,398 @@
+#include "ParticleSystem.h"
+
+#include <algorithm>
+#include <array>
+#include <string>
+
+#include <glm/gtc/constants.hpp>
+
+#include "Hazel/Core/AssertionHandler.h"
+#include "Hazel/Core/CpuFeatures.h"
+#include "Hazel/Renderer/RenderCommand.h"
+#include "Hazel/Renderer/Shader.h"
+#include "Hazel/Renderer/VertexArray.h"
+
+#if HZ_ARCH_X86
+    #include <emmintrin.h>
+#endif
+
+namespace Hazel {
+
+namespace {
+// Particles are updated in blocks of this many, a multiple of the SIMD width. The blocks are the same whatever the
+// number of threads, which keeps the order of the particles - and so the results - independent of it.
+constexpr const std::uint32_t block_size{16 * 1024};
+// Quads filled per thread in draw()
+constexpr const std::size_t min_draw_chunk{4096};
+
+// Particle state in Mode::Gpu, one record per particle - see ParticleUpdate.glsl
+BufferLayout gpu_particle_layout()
+{
+    return {{{ShaderDataType::Float2, "a_position"},
+             {ShaderDataType::Float2, "a_velocity"},
+             {ShaderDataType::Float2, "a_rotation"},
+             {ShaderDataType::Float2, "a_life"},
+             {ShaderDataType::Float2, "a_size"},
+             {ShaderDataType::Float4, "a_color_begin"},
+             {ShaderDataType::Float4, "a_color_end"}},
+            VertexStepRate::PerInstance};
+}
+constexpr const std::uint32_t gpu_particle_floats{18};
+
+// value[i] += rate[i] * timestep_s for i in [begin, end). The SIMD loop and the scalar tail perform the same
+// single-precision multiply and add, so the results don't depend on how the range is split.
+void advance(float* value, float const* rate, std::uint32_t begin, std::uint32_t end, float timestep_s) noexcept
+{
+    auto i{begin};
+#if HZ_ARCH_X86
+    auto const dt{_mm_set1_ps(timestep_s)};
+    for (; i + 4 <= end; i += 4) {
+        _mm_storeu_ps(value + i, _mm_add_ps(_mm_loadu_ps(value + i), _mm_mul_ps(_mm_loadu_ps(rate + i), dt)));
+    }
+#endif
+    for (; i != end; ++i) {
+        value[i] += rate[i] * timestep_s;
+    }
+}
+
+// value[i] -= timestep_s for i in [begin, end)
+void decrease(float* value, std::uint32_t begin, std::uint32_t end, float timestep_s) noexcept
+{
+    auto i{begin};
+#if HZ_ARCH_X86
+    auto const dt{_mm_set1_ps(timestep_s)};
+    for (; i + 4 <= end; i += 4) {
+        _mm_storeu_ps(value + i, _mm_sub_ps(_mm_loadu_ps(value + i), dt));
+    }
+#endif
+    for (; i != end; ++i) {
+        value[i] -= timestep_s;
+    }
+}
+}  // namespace
+
+struct ParticleSystem::GpuParticles {
+    struct Emission {
+        ParticleProps props;
+        std::uint32_t first;  // slot of the first particle, the slots wrap around at max_particles
+        std::uint32_t count;
+        std::uint32_t seed;
+    };
+
+    explicit GpuParticles(std::uint32_t max_particles)
+    {
+        // Slots start out dead, with no remaining life
+        std::vector<float> const dead(static_cast<std::size_t>(max_particles) * gpu_particle_floats, 0.0f);
+        constexpr std::array<std::uint32_t, 6> quad_indices{0, 1, 2, 2, 3, 0};
+        for (auto& vertex_array : state) {
+            auto buffer{VertexBuffer::create(dead.data(), static_cast<std::uint32_t>(dead.size() * sizeof(float)))};
+            buffer->setLayout(gpu_particle_layout());
+            vertex_array = VertexArray::create();
+            vertex_array->addVertexBuffer(std::move(buffer));
+            vertex_array->setIndexBuffer(IndexBuffer::create(quad_indices));
+        }
+        no_attributes = VertexArray::create();
+
+        std::vector<std::string> const outputs{"v_position", "v_velocity",    "v_rotation", "v_life",
+                                               "v_size",     "v_color_begin", "v_color_end"};
+        spawn_shader = Shader::create("assets/shaders/ParticleSpawn.glsl", outputs);
+        update_shader = Shader::create("assets/shaders/ParticleUpdate.glsl", outputs);
+        render_shader = Shader::create("assets/shaders/ParticleRender.glsl");
+    }
+
+    VertexBuffer& stateBuffer(std::uint32_t index) const noexcept { return *state[index]->getVertexBuffers().front(); }
+
+    // Ping-ponged: the update pass reads one and captures into the other, which is then drawn
+    std::array<Scope<VertexArray>, 2> state;
+    std::uint32_t current{0};
+    Scope<VertexArray> no_attributes;  // the spawn pass generates everything from the emission parameters
+    Scope<Shader> spawn_shader;
+    Scope<Shader> update_shader;
+    Scope<Shader> render_shader;
+    std::uint32_t next_slot{0};
+    std::vector<Emission> emissions;  // spawned in the next onUpdate
+};
+
+ParticleSystem::ParticleSystem(std::uint32_t max_particles, std::uint64_t seed)
+    : max_particles_{max_particles}, position_x_(max_particles), position_y_(max_particles),
+      velocity_x_(max_particles), velocity_y_(max_particles), rotation_(max_particles),
+      angular_velocity_(max_particles), life_remaining_(max_particles), inverse_lifetime_(max_particles),
+      size_begin_(max_particles), size_end_(max_particles), color_begin_(max_particles), color_end_(max_particles),
+      random_{seed}
+{
+    HZ_EXPECTS(max_particles != 0, DefaultCoreHandler, Hazel::Enforce, "ParticleSystem needs room for a particle");
+}
+
+ParticleSystem::~ParticleSystem() = default;
+
+void ParticleSystem::onUpdate(float timestep_s)
+{
+    HZ_PROFILE_FUNCTION();
+
+    if (gpu_) {
+        updateGpu(timestep_s);
+        return;
+    }
+
+    auto const block_count{(alive_count_ + block_size - 1) / block_size};
+    block_ends_.resize(block_count);
+    auto const update{[this, timestep_s](std::size_t begin, std::size_t end) {
+        for (auto block{begin}; block != end; ++block) {
+            auto const first{static_cast<std::uint32_t>(block) * block_size};
+            block_ends_[block] = updateBlock(first, std::min(first + block_size, alive_count_), timestep_s);
+        }
+    }};
+    if (workers_) {
+        workers_->parallelFor(block_count, 1, update);
+    }
+    else {
+        update(0, block_count);
+    }
+    mergeBlocks(block_count);
+
+    if (replace_index_ >= alive_count_) {
+        replace_index_ = 0;
+    }
+}
+
+std::uint32_t ParticleSystem::updateBlock(std::uint32_t begin, std::uint32_t end, float timestep_s) noexcept
+{
+    // Each attribute is streamed separately - one pass per array keeps the loops trivially vectorizable
+    advance(position_x_.data(), velocity_x_.data(), begin, end, timestep_s);
+    advance(position_y_.data(), velocity_y_.data(), begin, end, timestep_s);
+    advance(rotation_.data(), angular_velocity_.data(), begin, end, timestep_s);
+    decrease(life_remaining_.data(), begin, end, timestep_s);
+
+    for (auto i{begin}; i < end;) {
+        if (life_remaining_[i] > 0.0f) {
+            ++i;
+            continue;
+        }
+        moveParticle(--end, i);
+    }
+    return end;
+}
+
+void ParticleSystem::mergeBlocks(std::uint32_t block_count) noexcept
+{
+    if (block_count == 0) {
+        return;
+    }
+
+    std::uint32_t alive_count{0};
+    for (std::uint32_t block{0}; block != block_count; ++block) {
+        alive_count += block_ends_[block] - block * block_size;
+    }
+
+    // Gaps below the new alive count are filled with the live particles above it, last one first - there are exactly
+    // as many of those as there are gaps
+    auto source_block{block_count - 1};
+    auto source{block_ends_[source_block]};  // one past the next particle to move
+    for (std::uint32_t block{0}; block != block_count; ++block) {
+        auto const gap_end{std::min((block + 1) * block_size, alive_count)};
+        for (auto gap{block_ends_[block]}; gap < gap_end; ++gap) {
+            while (source == source_block * block_size) {
+                source = block_ends_[--source_block];
+            }
+            moveParticle(--source, gap);
+        }
+    }
+    alive_count_ = alive_count;
+}
+
+void ParticleSystem::updateGpu(float timestep_s)
+{
+    auto& gpu{*gpu_};
+    auto& state{gpu.stateBuffer(gpu.current)};
+    auto const stride{state.getLayout().getStride()};
+
+    // New particles first, so that they are advanced in this update just like on the CPU
+    auto& spawn{*gpu.spawn_shader};
+    spawn.bind();
+    for (auto const& emission : gpu.emissions) {
+        auto const& props{emission.props};
+        spawn.setUniform("u_position", props.position);
+        spawn.setUniform("u_velocity", props.velocity);
+        spawn.setUniform("u_velocity_variation", props.velocity_variation);
+        spawn.setUniform("u_color_begin", props.color_begin);
+        spawn.setUniform("u_color_end", props.color_end);
+        spawn.setUniform("u_size", glm::vec3{props.size_begin, props.size_end, props.size_variation});
+        spawn.setUniform("u_lifetime", props.lifetime);
+        spawn.setUniform("u_angular_velocity", props.angular_velocity);
+        spawn.setUniform("u_seed", static_cast<int>(emission.seed));
+
+        auto const first_count{std::min(emission.count, max_particles_ - emission.first)};
+        spawn.setUniform("u_instance_offset", 0);
+        RenderCommand::captureInstances(*gpu.no_attributes, first_count, state, emission.first * stride);
+        if (first_count != emission.count) {
+            spawn.setUniform("u_instance_offset", static_cast<int>(first_count));
+            RenderCommand::captureInstances(*gpu.no_attributes, emission.count - first_count, state, 0);
+        }
+    }
+    gpu.emissions.clear();
+
+    auto& update{*gpu.update_shader};
+    update.bind();
+    update.setUniform("u_timestep", timestep_s);
+    RenderCommand::captureInstances(*gpu.state[gpu.current], max_particles_, gpu.stateBuffer(1 - gpu.current));
+    gpu.current = 1 - gpu.current;
+}
+
+void ParticleSystem::emitGpu(ParticleProps const& props, std::uint32_t count)
+{
+    auto& gpu{*gpu_};
+    count = std::min(count, max_particles_);
+    if (count == 0) {
+        return;
+    }
+    gpu.emissions.push_back({props, gpu.next_slot, count, random_.nextUInt()});
+    gpu.next_slot = (gpu.next_slot + count) % max_particles_;
+    alive_count_ = std::min(alive_count_ + count, max_particles_);
+}
+
+void ParticleSystem::moveParticle(std::uint32_t from, std::uint32_t to) noexcept
+{
+    position_x_[to] = position_x_[from];
+    position_y_[to] = position_y_[from];
+    velocity_x_[to] = velocity_x_[from];
+    velocity_y_[to] = velocity_y_[from];
+    rotation_[to] = rotation_[from];
+    angular_velocity_[to] = angular_velocity_[from];
+    life_remaining_[to] = life_remaining_[from];
+    inverse_lifetime_[to] = inverse_lifetime_[from];
+    size_begin_[to] = size_begin_[from];
+    size_end_[to] = size_end_[from];
+    color_begin_[to] = color_begin_[from];
+    color_end_[to] = color_end_[from];
+}
+
+void ParticleSystem::onRender(OrthographicCamera const& camera, float z)
+{
+    Renderer2D::beginScene(camera);
+    draw(z);
+    Renderer2D::endScene();
+}
+
+void ParticleSystem::draw(float z)
+{
+    HZ_PROFILE_FUNCTION();
+
+    if (gpu_) {
+        if (alive_count_ != 0) {
+            auto& render{*gpu_->render_shader};
+            render.bind();
+            render.setUniform("u_z", z);
+            Renderer2D::drawInstanced(render, *gpu_->state[gpu_->current], max_particles_);
+        }
+        return;
+    }
+
+    quads_.resize(alive_count_);
+    auto const fill{[this, z](std::size_t begin, std::size_t end) {
+        for (auto i{begin}; i != end; ++i) {
+            // Fade from the begin to the end values over the particle's lifetime
+            auto const life{life_remaining_[i] * inverse_lifetime_[i]};
+            auto const size{size_end_[i] + (size_begin_[i] - size_end_[i]) * life};
+
+            auto& quad{quads_[i]};
+            quad.position = {position_x_[i], position_y_[i], z};
+            quad.rotation = rotation_[i];
+            quad.size = {size, size};
+            quad.color = glm::mix(color_end_[i], color_begin_[i], life);
+        }
+    }};
+    if (workers_) {
+        workers_->parallelFor(alive_count_, min_draw_chunk, fill);
+    }
+    else {
+        fill(0, alive_count_);
+    }
+    Renderer2D::drawQuads(quads_);
+}
+
+void ParticleSystem::emit(ParticleProps const& props)
+{
+    if (gpu_) {
+        emitGpu(props, 1);
+        return;
+    }
+
+    float const random[4]{random_.nextFloat(), random_.nextFloat(), random_.nextFloat(), random_.nextFloat()};
+    spawn(props, random);
+}
+
+void ParticleSystem::emit(ParticleProps const& props, std::uint32_t count)
+{
+    HZ_PROFILE_FUNCTION();
+
+    if (gpu_) {
+        emitGpu(props, count);
+        return;
+    }
+
+    random_values_.resize(static_cast<std::size_t>(count) * 4);
+    random_.fill(random_values_);
+    for (std::uint32_t i{0}; i != count; ++i) {
+        spawn(props, &random_values_[static_cast<std::size_t>(i) * 4]);
+    }
+}
+
+void ParticleSystem::spawn(ParticleProps const& props, float const* random) noexcept
+{
+    std::uint32_t index;
+    if (alive_count_ != max_particles_) {
+        index = alive_count_++;
+    }
+    else {
+        index = replace_index_;
+        replace_index_ = (replace_index_ + 1) % max_particles_;
+    }
+
+    position_x_[index] = props.position.x;
+    position_y_[index] = props.position.y;
+    rotation_[index] = random[0] * 2.0f * glm::pi<float>();
+    angular_velocity_[index] = props.angular_velocity;
+
+    velocity_x_[index] = props.velocity.x + props.velocity_variation.x * (random[1] - 0.5f);
+    velocity_y_[index] = props.velocity.y + props.velocity_variation.y * (random[2] - 0.5f);
+
+    color_begin_[index] = props.color_begin;
+    color_end_[index] = props.color_end;
+
+    life_remaining_[index] = props.lifetime;
+    inverse_lifetime_[index] = 1.0f / props.lifetime;
+    size_begin_[index] = props.size_begin + props.size_variation * (random[3] - 0.6f);
+    size_end_[index] = props.size_end;
+}
+
+void ParticleSystem::setMode(Mode mode)
+{
+    if (mode == getMode()) {
+        return;
+    }
+
+    alive_count_ = 0;
+    replace_index_ = 0;
+    gpu_.reset();
+    if (mode == Mode::Gpu && RenderCommand::supportsTransformFeedback()) {
+        gpu_ = makeScope<GpuParticles>(max_particles_);
+    }
+}
+
+void ParticleSystem::setWorkerThreadCount(std::uint32_t count)
+{
+    if (count == getWorkerThreadCount()) {
+        return;
+    }
+    workers_.reset();
+    if (count != 0) {
+        workers_ = makeScope<ThreadPool>(count);
+    }
+}
+
+std::uint32_t ParticleSystem::getWorkerThreadCount() const noexcept
+{
+    return workers_ ? workers_->getWorkerCount() : 0;
+}
+
+}  // namespace Hazel
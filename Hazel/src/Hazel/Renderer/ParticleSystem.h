@@ -0,0 +1,111 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "Hazel/Core/Base.h"
+#include "Hazel/Core/Random.h"
+#include "Hazel/Core/ThreadPool.h"
+#include "Hazel/Renderer/OrthographicCamera.h"
+#include "Hazel/Renderer/Renderer2D.h"
+
+namespace Hazel
+{
+struct ParticleProps {
+    glm::vec2 position;
+    glm::vec2 velocity, velocity_variation;
+    glm::vec4 color_begin, color_end;
+    float size_begin, size_end, size_variation;
+    float lifetime = 1.0f;
+    float angular_velocity = 0.01f;  // radians per second
+};
+
+// Fixed-capacity pool of flat-colored particles, drawn through Renderer2D::drawQuads.
+// The particles are stored as a structure of arrays, with the live ones packed at the front - updating and drawing
+// only touch live particles, and dead ones are swapped out with a live one from the back.
+//
+// The live range is simulated in fixed-size blocks, optionally spread over worker threads - the blocks don't depend
+// on the number of threads, so neither do the results.
+//
+// In Mode::Gpu the particles live in GPU buffers instead and are advanced with transform feedback - only the
+// parameters of each emission are uploaded, so the CPU cost doesn't depend on the number of particles.
+class ParticleSystem {
+public:
+    enum class Mode {
+        Cpu,
+        Gpu,  // falls back to Cpu on backends without transform feedback, e.g. RendererAPI::API::Null
+    };
+
+    // Particle systems constructed with the same seed emit the same particles
+    explicit ParticleSystem(std::uint32_t max_particles, std::uint64_t seed = 0);
+    ~ParticleSystem();
+
+    // Integrates the live particles and removes the ones that ran out of life
+    void onUpdate(float timestep_s);
+    // Draws the live particles in a scene of their own
+    void onRender(OrthographicCamera const& camera, float z = 0.0f);
+    // Submits the live particles at depth `z` - must be called between Renderer2D::beginScene and endScene
+    void draw(float z = 0.0f);
+
+    // Once the pool is full, new particles replace live ones
+    void emit(ParticleProps const& props);
+    // Emits `count` particles, generating their random variations in bulk
+    void emit(ParticleProps const& props, std::uint32_t count);
+
+    // Number of worker threads simulating the particles and filling the quads for Renderer2D, together with the
+    // calling thread. 0 (the default) runs everything on the calling thread only.
+    void setWorkerThreadCount(std::uint32_t count);
+    std::uint32_t getWorkerThreadCount() const noexcept;
+
+    // Switching modes removes every particle
+    void setMode(Mode mode);
+    Mode getMode() const noexcept { return gpu_ ? Mode::Gpu : Mode::Cpu; }
+
+    // In Mode::Gpu, the particle slots emitted into so far - particles that died on the GPU are still counted
+    std::uint32_t getAliveCount() const noexcept { return alive_count_; }
+    std::uint32_t getMaxParticles() const noexcept { return max_particles_; }
+
+private:
+    // Reads the particle state in the headless tests, which check that it doesn't depend on the number of threads
+    friend class ParticleSystemInspector;
+
+    struct GpuParticles;
+
+    // Integrates the particles [begin, end) and packs the ones still alive at the front of the range.
+    // Returns the end of the live particles.
+    std::uint32_t updateBlock(std::uint32_t begin, std::uint32_t end, float timestep_s) noexcept;
+    // Closes the gaps left between the blocks by updateBlock
+    void mergeBlocks(std::uint32_t block_count) noexcept;
+    void moveParticle(std::uint32_t from, std::uint32_t to) noexcept;
+    void updateGpu(float timestep_s);
+    void emitGpu(ParticleProps const& props, std::uint32_t count);
+    // Adds a particle with the variations given by 4 random values in [0, 1)
+    void spawn(ParticleProps const& props, float const* random) noexcept;
+
+    std::uint32_t max_particles_;
+    std::uint32_t alive_count_{0};
+    std::uint32_t replace_index_{0};  // next live particle replaced by emit() while the pool is full
+
+    std::vector<float> position_x_;
+    std::vector<float> position_y_;
+    std::vector<float> velocity_x_;
+    std::vector<float> velocity_y_;
+    std::vector<float> rotation_;
+    std::vector<float> angular_velocity_;
+    std::vector<float> life_remaining_;
+    std::vector<float> inverse_lifetime_;
+    std::vector<float> size_begin_;
+    std::vector<float> size_end_;
+    std::vector<glm::vec4> color_begin_;
+    std::vector<glm::vec4> color_end_;
+
+    std::vector<std::uint32_t> block_ends_;  // end of each block's live particles after updateBlock
+    std::vector<QuadInstance> quads_;        // draw() input to Renderer2D::drawQuads
+    Scope<ThreadPool> workers_;
+    Scope<GpuParticles> gpu_;  // only in Mode::Gpu
+    Random random_;
+    std::vector<float> random_values_;  // bulk emit() scratch
+};
+}  // namespace Hazel
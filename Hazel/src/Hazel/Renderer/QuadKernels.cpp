@@ -0,0 +1,157 @@
+#include "QuadKernels.h"
+
+#include <cmath>
+
+#if HZ_ARCH_X86
+    #include "Hazel/Renderer/QuadKernelsX86.h"
+#endif
+
+namespace Hazel {
+
+void writeQuadsScalar(const QuadInstance* quads, std::size_t count, float texture_index, float tiling_factor,
+                      QuadVertex* vertices) noexcept
+{
+    for (std::size_t i{0}; i != count; ++i) {
+        auto const& quad{quads[i]};
+        auto const c{quad.rotation != 0.0f ? std::cos(quad.rotation) : 1.0f};
+        auto const s{quad.rotation != 0.0f ? std::sin(quad.rotation) : 0.0f};
+        auto const half_width{quad.size.x * 0.5f};
+        auto const half_height{quad.size.y * 0.5f};
+        glm::vec3 const x_axis{c * half_width, s * half_width, 0.0f};
+        glm::vec3 const y_axis{-s * half_height, c * half_height, 0.0f};
+
+        vertices[0] = {quad.position - x_axis - y_axis, quad.color, {quad.uv_min.x, quad.uv_min.y}, texture_index,
+                       tiling_factor};
+        vertices[1] = {quad.position + x_axis - y_axis, quad.color, {quad.uv_max.x, quad.uv_min.y}, texture_index,
+                       tiling_factor};
+        vertices[2] = {quad.position + x_axis + y_axis, quad.color, {quad.uv_max.x, quad.uv_max.y}, texture_index,
+                       tiling_factor};
+        vertices[3] = {quad.position - x_axis + y_axis, quad.color, {quad.uv_min.x, quad.uv_max.y}, texture_index,
+                       tiling_factor};
+        vertices += 4;
+    }
+}
+
+#if HZ_ARCH_X86
+namespace {
+inline void sincos4(__m128 x, __m128& sin_out, __m128& cos_out) noexcept
+{
+    auto const sign_mask{_mm_castsi128_ps(_mm_set1_epi32(static_cast<int>(0x80000000)))};
+
+    auto sign_bit_sin{_mm_and_ps(x, sign_mask)};
+    x = _mm_andnot_ps(sign_mask, x);
+
+    // Reduce to the octant, rounding j up to an even number
+    auto j{_mm_cvttps_epi32(_mm_mul_ps(x, _mm_set1_ps(four_over_pi)))};
+    j = _mm_add_epi32(j, _mm_set1_epi32(1));
+    j = _mm_and_si128(j, _mm_set1_epi32(~1));
+    auto const y{_mm_cvtepi32_ps(j)};
+
+    auto const swap_sign_bit_sin{_mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(j, _mm_set1_epi32(4)), 29))};
+    auto const poly_mask{
+        _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(j, _mm_set1_epi32(2)), _mm_setzero_si128()))};
+    auto const sign_bit_cos{_mm_castsi128_ps(
+        _mm_slli_epi32(_mm_andnot_si128(_mm_sub_epi32(j, _mm_set1_epi32(2)), _mm_set1_epi32(4)), 29))};
+    sign_bit_sin = _mm_xor_ps(sign_bit_sin, swap_sign_bit_sin);
+
+    // Extended precision modular arithmetic: x - j * pi/4
+    x = _mm_add_ps(x, _mm_mul_ps(y, _mm_set1_ps(minus_dp1)));
+    x = _mm_add_ps(x, _mm_mul_ps(y, _mm_set1_ps(minus_dp2)));
+    x = _mm_add_ps(x, _mm_mul_ps(y, _mm_set1_ps(minus_dp3)));
+
+    auto const z{_mm_mul_ps(x, x)};
+
+    auto cos_poly{_mm_set1_ps(coscof_p0)};
+    cos_poly = _mm_add_ps(_mm_mul_ps(cos_poly, z), _mm_set1_ps(coscof_p1));
+    cos_poly = _mm_add_ps(_mm_mul_ps(cos_poly, z), _mm_set1_ps(coscof_p2));
+    cos_poly = _mm_mul_ps(_mm_mul_ps(cos_poly, z), z);
+    cos_poly = _mm_sub_ps(cos_poly, _mm_mul_ps(z, _mm_set1_ps(0.5f)));
+    cos_poly = _mm_add_ps(cos_poly, _mm_set1_ps(1.0f));
+
+    auto sin_poly{_mm_set1_ps(sincof_p0)};
+    sin_poly = _mm_add_ps(_mm_mul_ps(sin_poly, z), _mm_set1_ps(sincof_p1));
+    sin_poly = _mm_add_ps(_mm_mul_ps(sin_poly, z), _mm_set1_ps(sincof_p2));
+    sin_poly = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(sin_poly, z), x), x);
+
+    auto const s{_mm_or_ps(_mm_and_ps(poly_mask, sin_poly), _mm_andnot_ps(poly_mask, cos_poly))};
+    auto const c{_mm_or_ps(_mm_and_ps(poly_mask, cos_poly), _mm_andnot_ps(poly_mask, sin_poly))};
+    sin_out = _mm_xor_ps(s, sign_bit_sin);
+    cos_out = _mm_xor_ps(c, sign_bit_cos);
+}
+
+// Computes the corners of 4 quads and streams their vertices to `out`
+inline void writeQuads4(const QuadInstance* quads, std::size_t count, float texture_index, float tiling_factor,
+                        float* out) noexcept
+{
+    __m128 px, py, rotation, sx, sy;
+    loadQuads4(quads, px, py, rotation, sx, sy);
+
+    auto s{_mm_setzero_ps()};
+    auto c{_mm_set1_ps(1.0f)};
+    if (_mm_movemask_ps(_mm_cmpneq_ps(rotation, _mm_setzero_ps())) != 0) {
+        sincos4(rotation, s, c);
+    }
+
+    auto const half{_mm_set1_ps(0.5f)};
+    auto const half_width{_mm_mul_ps(sx, half)};
+    auto const half_height{_mm_mul_ps(sy, half)};
+    // Half-extent axes of the (rotated) quads
+    auto const ax{_mm_mul_ps(c, half_width)};
+    auto const ay{_mm_mul_ps(s, half_width)};
+    auto const bx{_mm_sub_ps(_mm_setzero_ps(), _mm_mul_ps(s, half_height))};
+    auto const by{_mm_mul_ps(c, half_height)};
+
+    alignas(16) float xs[4][4];
+    alignas(16) float ys[4][4];
+    _mm_store_ps(xs[0], _mm_sub_ps(_mm_sub_ps(px, ax), bx));
+    _mm_store_ps(ys[0], _mm_sub_ps(_mm_sub_ps(py, ay), by));
+    _mm_store_ps(xs[1], _mm_sub_ps(_mm_add_ps(px, ax), bx));
+    _mm_store_ps(ys[1], _mm_sub_ps(_mm_add_ps(py, ay), by));
+    _mm_store_ps(xs[2], _mm_add_ps(_mm_add_ps(px, ax), bx));
+    _mm_store_ps(ys[2], _mm_add_ps(_mm_add_ps(py, ay), by));
+    _mm_store_ps(xs[3], _mm_add_ps(_mm_sub_ps(px, ax), bx));
+    _mm_store_ps(ys[3], _mm_add_ps(_mm_sub_ps(py, ay), by));
+
+    for (std::size_t lane{0}; lane != count; ++lane, out += floats_per_quad) {
+        const float lane_xs[4]{xs[0][lane], xs[1][lane], xs[2][lane], xs[3][lane]};
+        const float lane_ys[4]{ys[0][lane], ys[1][lane], ys[2][lane], ys[3][lane]};
+        streamQuad(out, lane_xs, lane_ys, quads[lane], texture_index, tiling_factor);
+    }
+}
+}  // namespace
+
+void writeQuadsSSE2(const QuadInstance* quads, std::size_t count, float texture_index, float tiling_factor,
+                    QuadVertex* vertices) noexcept
+{
+    auto* out{reinterpret_cast<float*>(vertices)};
+
+    std::size_t i{0};
+    for (; i + 4 <= count; i += 4, out += 4 * floats_per_quad) {
+        writeQuads4(quads + i, 4, texture_index, tiling_factor, out);
+    }
+    if (i != count) {
+        // Only the valid quads of the padded tail are written out
+        QuadTail<4> tail;
+        writeQuads4(tail.fill(quads + i, count - i), count - i, texture_index, tiling_factor, out);
+    }
+
+    // Make the streamed vertices visible before the buffer gets uploaded
+    _mm_sfence();
+}
+#endif
+
+QuadKernelInfo selectQuadKernel() noexcept
+{
+#if HZ_ARCH_X86
+    auto const& cpu{CpuFeatures::get()};
+    if (cpu.avx2) {
+        return {writeQuadsAVX2, "AVX2"};
+    }
+    if (cpu.sse2) {
+        return {writeQuadsSSE2, "SSE2"};
+    }
+#endif
+    return {writeQuadsScalar, "scalar"};
+}
+
+}  // namespace Hazel
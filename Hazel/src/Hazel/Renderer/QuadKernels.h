@@ -0,0 +1,55 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include <glm/glm.hpp>
+
+#include "Hazel/Core/CpuFeatures.h"
+#include "Hazel/Renderer/Renderer2D.h"
+
+namespace Hazel {
+
+struct QuadVertex {
+    glm::vec3 position;
+    glm::vec4 color;
+    glm::vec2 tex_coord;
+    float tex_index;
+    float tiling_factor;
+};
+static_assert(sizeof(QuadVertex) == 11 * sizeof(float), "QuadKernels expect a tightly packed QuadVertex");
+
+// Quantized QuadVertex used in Renderer2D::QuadMode::Compact - 24 instead of 44 bytes per vertex
+struct CompactQuadVertex {
+    glm::vec3 position;
+    std::uint32_t color;                     // RGBA8, normalized
+    std::array<std::uint16_t, 2> tex_coord;  // 16-bit normalized
+    std::uint32_t texture;                   // texture index in the low 8 bits, tiling factor as 16.8 fixed point
+};
+static_assert(sizeof(CompactQuadVertex) == 24, "CompactQuadVertex must match the layout in TextureCompact.glsl");
+
+// Writes the four vertices of each of `count` quads into `vertices`, in the corner order expected by
+// the Renderer2D index buffer. `vertices` must be 16-byte aligned - the SIMD kernels use streaming stores.
+using QuadKernel = void (*)(const QuadInstance* quads, std::size_t count, float texture_index, float tiling_factor,
+                            QuadVertex* vertices) noexcept;
+
+struct QuadKernelInfo {
+    QuadKernel write;
+    const char* name;
+};
+
+void writeQuadsScalar(const QuadInstance* quads, std::size_t count, float texture_index, float tiling_factor,
+                      QuadVertex* vertices) noexcept;
+#if HZ_ARCH_X86
+void writeQuadsSSE2(const QuadInstance* quads, std::size_t count, float texture_index, float tiling_factor,
+                    QuadVertex* vertices) noexcept;
+// Compiled with AVX2 code generation enabled - must only be called if CpuFeatures::avx2 is set
+void writeQuadsAVX2(const QuadInstance* quads, std::size_t count, float texture_index, float tiling_factor,
+                    QuadVertex* vertices) noexcept;
+#endif
+
+// Picks the widest kernel supported by the CPU the program is running on
+QuadKernelInfo selectQuadKernel() noexcept;
+
+}  // namespace Hazel
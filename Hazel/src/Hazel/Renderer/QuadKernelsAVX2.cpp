@@ -0,0 +1,135 @@
+// This translation unit is compiled with AVX2 code generation enabled (see Hazel/CMakeLists.txt).
+// Nothing in here may be called unless CpuFeatures::avx2 is set.
+
+#include "QuadKernels.h"
+
+#if HZ_ARCH_X86
+
+    #include <immintrin.h>
+
+    #include "Hazel/Renderer/QuadKernelsX86.h"
+
+namespace Hazel {
+
+namespace {
+inline __m256 combine(__m128 low, __m128 high) noexcept
+{
+    return _mm256_insertf128_ps(_mm256_castps128_ps256(low), high, 1);
+}
+
+inline void sincos8(__m256 x, __m256& sin_out, __m256& cos_out) noexcept
+{
+    auto const sign_mask{_mm256_castsi256_ps(_mm256_set1_epi32(static_cast<int>(0x80000000)))};
+
+    auto sign_bit_sin{_mm256_and_ps(x, sign_mask)};
+    x = _mm256_andnot_ps(sign_mask, x);
+
+    // Reduce to the octant, rounding j up to an even number
+    auto j{_mm256_cvttps_epi32(_mm256_mul_ps(x, _mm256_set1_ps(four_over_pi)))};
+    j = _mm256_add_epi32(j, _mm256_set1_epi32(1));
+    j = _mm256_and_si256(j, _mm256_set1_epi32(~1));
+    auto const y{_mm256_cvtepi32_ps(j)};
+
+    auto const swap_sign_bit_sin{
+        _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(j, _mm256_set1_epi32(4)), 29))};
+    auto const poly_mask{_mm256_castsi256_ps(
+        _mm256_cmpeq_epi32(_mm256_and_si256(j, _mm256_set1_epi32(2)), _mm256_setzero_si256()))};
+    auto const sign_bit_cos{_mm256_castsi256_ps(
+        _mm256_slli_epi32(_mm256_andnot_si256(_mm256_sub_epi32(j, _mm256_set1_epi32(2)), _mm256_set1_epi32(4)), 29))};
+    sign_bit_sin = _mm256_xor_ps(sign_bit_sin, swap_sign_bit_sin);
+
+    // Extended precision modular arithmetic: x - j * pi/4
+    x = _mm256_add_ps(x, _mm256_mul_ps(y, _mm256_set1_ps(minus_dp1)));
+    x = _mm256_add_ps(x, _mm256_mul_ps(y, _mm256_set1_ps(minus_dp2)));
+    x = _mm256_add_ps(x, _mm256_mul_ps(y, _mm256_set1_ps(minus_dp3)));
+
+    auto const z{_mm256_mul_ps(x, x)};
+
+    auto cos_poly{_mm256_set1_ps(coscof_p0)};
+    cos_poly = _mm256_add_ps(_mm256_mul_ps(cos_poly, z), _mm256_set1_ps(coscof_p1));
+    cos_poly = _mm256_add_ps(_mm256_mul_ps(cos_poly, z), _mm256_set1_ps(coscof_p2));
+    cos_poly = _mm256_mul_ps(_mm256_mul_ps(cos_poly, z), z);
+    cos_poly = _mm256_sub_ps(cos_poly, _mm256_mul_ps(z, _mm256_set1_ps(0.5f)));
+    cos_poly = _mm256_add_ps(cos_poly, _mm256_set1_ps(1.0f));
+
+    auto sin_poly{_mm256_set1_ps(sincof_p0)};
+    sin_poly = _mm256_add_ps(_mm256_mul_ps(sin_poly, z), _mm256_set1_ps(sincof_p1));
+    sin_poly = _mm256_add_ps(_mm256_mul_ps(sin_poly, z), _mm256_set1_ps(sincof_p2));
+    sin_poly = _mm256_add_ps(_mm256_mul_ps(_mm256_mul_ps(sin_poly, z), x), x);
+
+    sin_out = _mm256_xor_ps(_mm256_blendv_ps(cos_poly, sin_poly, poly_mask), sign_bit_sin);
+    cos_out = _mm256_xor_ps(_mm256_blendv_ps(sin_poly, cos_poly, poly_mask), sign_bit_cos);
+}
+
+// Computes the corners of 8 quads and streams their vertices to `out`
+inline void writeQuads8(const QuadInstance* quads, std::size_t count, float texture_index, float tiling_factor,
+                        float* out) noexcept
+{
+    __m128 px_lo, py_lo, rotation_lo, sx_lo, sy_lo;
+    __m128 px_hi, py_hi, rotation_hi, sx_hi, sy_hi;
+    loadQuads4(quads, px_lo, py_lo, rotation_lo, sx_lo, sy_lo);
+    loadQuads4(quads + 4, px_hi, py_hi, rotation_hi, sx_hi, sy_hi);
+    auto const px{combine(px_lo, px_hi)};
+    auto const py{combine(py_lo, py_hi)};
+    auto const rotation{combine(rotation_lo, rotation_hi)};
+    auto const sx{combine(sx_lo, sx_hi)};
+    auto const sy{combine(sy_lo, sy_hi)};
+
+    auto s{_mm256_setzero_ps()};
+    auto c{_mm256_set1_ps(1.0f)};
+    if (_mm256_movemask_ps(_mm256_cmp_ps(rotation, _mm256_setzero_ps(), _CMP_NEQ_UQ)) != 0) {
+        sincos8(rotation, s, c);
+    }
+
+    auto const half{_mm256_set1_ps(0.5f)};
+    auto const half_width{_mm256_mul_ps(sx, half)};
+    auto const half_height{_mm256_mul_ps(sy, half)};
+    // Half-extent axes of the (rotated) quads
+    auto const ax{_mm256_mul_ps(c, half_width)};
+    auto const ay{_mm256_mul_ps(s, half_width)};
+    auto const bx{_mm256_sub_ps(_mm256_setzero_ps(), _mm256_mul_ps(s, half_height))};
+    auto const by{_mm256_mul_ps(c, half_height)};
+
+    alignas(32) float xs[4][8];
+    alignas(32) float ys[4][8];
+    _mm256_store_ps(xs[0], _mm256_sub_ps(_mm256_sub_ps(px, ax), bx));
+    _mm256_store_ps(ys[0], _mm256_sub_ps(_mm256_sub_ps(py, ay), by));
+    _mm256_store_ps(xs[1], _mm256_sub_ps(_mm256_add_ps(px, ax), bx));
+    _mm256_store_ps(ys[1], _mm256_sub_ps(_mm256_add_ps(py, ay), by));
+    _mm256_store_ps(xs[2], _mm256_add_ps(_mm256_add_ps(px, ax), bx));
+    _mm256_store_ps(ys[2], _mm256_add_ps(_mm256_add_ps(py, ay), by));
+    _mm256_store_ps(xs[3], _mm256_add_ps(_mm256_sub_ps(px, ax), bx));
+    _mm256_store_ps(ys[3], _mm256_add_ps(_mm256_sub_ps(py, ay), by));
+
+    for (std::size_t lane{0}; lane != count; ++lane, out += floats_per_quad) {
+        const float lane_xs[4]{xs[0][lane], xs[1][lane], xs[2][lane], xs[3][lane]};
+        const float lane_ys[4]{ys[0][lane], ys[1][lane], ys[2][lane], ys[3][lane]};
+        streamQuad(out, lane_xs, lane_ys, quads[lane], texture_index, tiling_factor);
+    }
+}
+}  // namespace
+
+void writeQuadsAVX2(const QuadInstance* quads, std::size_t count, float texture_index, float tiling_factor,
+                    QuadVertex* vertices) noexcept
+{
+    auto* out{reinterpret_cast<float*>(vertices)};
+
+    std::size_t i{0};
+    for (; i + 8 <= count; i += 8, out += 8 * floats_per_quad) {
+        writeQuads8(quads + i, 8, texture_index, tiling_factor, out);
+    }
+    if (i != count) {
+        // Only the valid quads of the padded tail are written out
+        QuadTail<8> tail;
+        writeQuads8(tail.fill(quads + i, count - i), count - i, texture_index, tiling_factor, out);
+    }
+
+    // Make the streamed vertices visible before the buffer gets uploaded
+    _mm_sfence();
+    // Avoid AVX-SSE transition penalties in the (non-VEX) code that follows
+    _mm256_zeroupper();
+}
+
+}  // namespace Hazel
+
+#endif
@@ -0,0 +1,110 @@
+#pragma once
+
+// Helpers shared by the x86 QuadKernels translation units.
+// Everything here has internal linkage on purpose: QuadKernelsAVX2.cpp is compiled with AVX2 code
+// generation, and sharing inline functions with external linkage between it and the SSE2 kernel
+// would let the linker pick the VEX-encoded copy for CPUs which do not support it.
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include <emmintrin.h>
+
+#include "Hazel/Renderer/QuadKernels.h"
+
+namespace Hazel {
+namespace {
+
+static_assert(offsetof(QuadInstance, position) == 0 && offsetof(QuadInstance, rotation) == 12 &&
+                  offsetof(QuadInstance, size) == 16 && offsetof(QuadInstance, uv_min) == 24 &&
+                  offsetof(QuadInstance, uv_max) == 32 && offsetof(QuadInstance, color) == 40,
+              "QuadKernels load QuadInstance members four floats at a time");
+
+constexpr std::size_t floats_per_quad{4 * sizeof(QuadVertex) / sizeof(float)};  // 44 floats == 11 * __m128
+
+// sincos range reduction and minimax polynomial coefficients (Cephes sinf/cosf)
+constexpr float four_over_pi{1.27323954473516f};
+constexpr float minus_dp1{-0.78515625f};
+constexpr float minus_dp2{-2.4187564849853515625e-4f};
+constexpr float minus_dp3{-3.77489497744594108e-8f};
+constexpr float sincof_p0{-1.9515295891e-4f};
+constexpr float sincof_p1{8.3321608736e-3f};
+constexpr float sincof_p2{-1.6666654611e-1f};
+constexpr float coscof_p0{2.443315711809948e-5f};
+constexpr float coscof_p1{-1.388731625493765e-3f};
+constexpr float coscof_p2{4.166664568298827e-2f};
+
+// Storage for the last, partial group of quads of a kernel, padded with copies of the last quad.
+// The copies are done bytewise so that no QuadInstance/glm constructors get instantiated here.
+template <std::size_t N>
+struct QuadTail {
+    alignas(QuadInstance) unsigned char storage[N * sizeof(QuadInstance)];
+
+    const QuadInstance* fill(const QuadInstance* quads, std::size_t count) noexcept
+    {
+        for (std::size_t i{0}; i != N; ++i) {
+            std::memcpy(storage + i * sizeof(QuadInstance), quads + (i < count ? i : count - 1),
+                        sizeof(QuadInstance));
+        }
+        return reinterpret_cast<const QuadInstance*>(storage);
+    }
+};
+
+// Streams the 4 vertices of a single quad, given the x/y coordinates of its corners
+inline void streamQuad(float* out, const float (&xs)[4], const float (&ys)[4], const QuadInstance& quad,
+                       float texture_index, float tiling_factor) noexcept
+{
+    auto const z{quad.position.z};
+    auto const r{quad.color.r};
+    auto const g{quad.color.g};
+    auto const b{quad.color.b};
+    auto const a{quad.color.a};
+    auto const u0{quad.uv_min.x};
+    auto const v0{quad.uv_min.y};
+    auto const u1{quad.uv_max.x};
+    auto const v1{quad.uv_max.y};
+    auto const ti{texture_index};
+    auto const tf{tiling_factor};
+
+    // 4 vertices x {position.xyz, color.rgba, tex_coord.uv, tex_index, tiling_factor} == 11 16-byte chunks
+    _mm_stream_ps(out + 0, _mm_setr_ps(xs[0], ys[0], z, r));
+    _mm_stream_ps(out + 4, _mm_setr_ps(g, b, a, u0));
+    _mm_stream_ps(out + 8, _mm_setr_ps(v0, ti, tf, xs[1]));
+    _mm_stream_ps(out + 12, _mm_setr_ps(ys[1], z, r, g));
+    _mm_stream_ps(out + 16, _mm_setr_ps(b, a, u1, v0));
+    _mm_stream_ps(out + 20, _mm_setr_ps(ti, tf, xs[2], ys[2]));
+    _mm_stream_ps(out + 24, _mm_setr_ps(z, r, g, b));
+    _mm_stream_ps(out + 28, _mm_setr_ps(a, u1, v1, ti));
+    _mm_stream_ps(out + 32, _mm_setr_ps(tf, xs[3], ys[3], z));
+    _mm_stream_ps(out + 36, _mm_loadu_ps(&quad.color.r));
+    _mm_stream_ps(out + 40, _mm_setr_ps(u0, v1, ti, tf));
+}
+
+// Loads {position.xyz, rotation} and {size.xy, uv_min.xy} of 4 quads, transposed to SoA form
+inline void loadQuads4(const QuadInstance* quads, __m128& px, __m128& py, __m128& rotation, __m128& sx,
+                       __m128& sy) noexcept
+{
+    auto const* base{reinterpret_cast<const float*>(quads)};
+    constexpr auto stride{sizeof(QuadInstance) / sizeof(float)};
+
+    __m128 r0{_mm_loadu_ps(base + 0 * stride)};
+    __m128 r1{_mm_loadu_ps(base + 1 * stride)};
+    __m128 r2{_mm_loadu_ps(base + 2 * stride)};
+    __m128 r3{_mm_loadu_ps(base + 3 * stride)};
+    _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+    px = r0;
+    py = r1;
+    rotation = r3;
+
+    __m128 s0{_mm_loadu_ps(base + 0 * stride + 4)};
+    __m128 s1{_mm_loadu_ps(base + 1 * stride + 4)};
+    __m128 s2{_mm_loadu_ps(base + 2 * stride + 4)};
+    __m128 s3{_mm_loadu_ps(base + 3 * stride + 4)};
+    _MM_TRANSPOSE4_PS(s0, s1, s2, s3);
+    sx = s0;
+    sy = s1;
+}
+
+}  // namespace
+}  // namespace Hazel
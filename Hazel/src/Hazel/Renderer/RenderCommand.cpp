@@ -1,8 +1,6 @@
 #include "RenderCommand.h"
 
-#include "Platform/OpenGL/OpenGLRendererAPI.h"
-
 namespace Hazel
 {
-RendererAPI* RenderCommand::s_renderer_api_{new OpenGLRendererAPI{}};
+Scope<RendererAPI> RenderCommand::s_renderer_api_{RendererAPI::create()};
 } // namespace Hazel
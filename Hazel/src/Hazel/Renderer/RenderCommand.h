@@ -5,7 +5,12 @@
 namespace Hazel {
 class RenderCommand {
 public:
-    static inline void init() { s_renderer_api_->init(); }
+    // (Re)creates the backend selected with RendererAPI::setAPI
+    static inline void init()
+    {
+        s_renderer_api_ = RendererAPI::create();
+        s_renderer_api_->init();
+    }
 
     static inline void setViewport(unsigned x, unsigned y, unsigned width, unsigned height) noexcept
     {
@@ -19,12 +24,27 @@ public:
 
     static inline void clear() { s_renderer_api_->clear(); }
 
-    static inline void drawIndexed(VertexArray const& vertex_array, std::uint32_t index_count = 0)
+    static inline void drawIndexed(VertexArray const& vertex_array, std::uint32_t index_count = 0,
+                                   std::uint32_t base_vertex = 0)
+    {
+        s_renderer_api_->drawIndexed(vertex_array, index_count, base_vertex);
+    }
+
+    static inline void drawIndexedInstanced(VertexArray const& vertex_array, std::uint32_t index_count,
+                                            std::uint32_t instance_count, std::uint32_t base_instance = 0)
+    {
+        s_renderer_api_->drawIndexedInstanced(vertex_array, index_count, instance_count, base_instance);
+    }
+
+    static inline bool supportsTransformFeedback() noexcept { return s_renderer_api_->supportsTransformFeedback(); }
+
+    static inline void captureInstances(VertexArray const& vertex_array, std::uint32_t instance_count,
+                                        VertexBuffer& destination, std::uint32_t offset = 0)
     {
-        s_renderer_api_->drawIndexed(vertex_array, index_count);
+        s_renderer_api_->captureInstances(vertex_array, instance_count, destination, offset);
     }
 
 private:
-    static RendererAPI* s_renderer_api_;
+    static Scope<RendererAPI> s_renderer_api_;
 };
 }  // namespace Hazel
@@ -0,0 +1,59 @@
+#include "RenderQueue.h"
+
+#include <array>
+#include <utility>
+
+namespace Hazel {
+
+void RenderQueue::sort()
+{
+    HZ_PROFILE_FUNCTION();
+
+    constexpr const std::uint32_t digit_bits{8};
+    constexpr const std::uint32_t digit_count{64 / digit_bits};
+    constexpr const std::uint32_t bucket_count{1u << digit_bits};
+
+    auto const size{entries_.size()};
+    if (size < 2) {
+        return;
+    }
+
+    // Key fields are mostly narrower than their bit range - only the digits that differ between keys need a pass
+    std::uint64_t all_set{~std::uint64_t{0}};
+    std::uint64_t any_set{0};
+    for (auto const& entry : entries_) {
+        all_set &= entry.key;
+        any_set |= entry.key;
+    }
+    auto const varying{all_set ^ any_set};
+    if (varying == 0) {
+        return;
+    }
+
+    std::array<std::array<std::uint32_t, bucket_count>, digit_count> counts{};
+    for (auto const& entry : entries_) {
+        for (std::uint32_t digit{0}; digit != digit_count; ++digit) {
+            ++counts[digit][(entry.key >> (digit * digit_bits)) & (bucket_count - 1)];
+        }
+    }
+
+    scratch_.resize(size);
+    for (std::uint32_t digit{0}; digit != digit_count; ++digit) {
+        auto const shift{digit * digit_bits};
+        if (((varying >> shift) & (bucket_count - 1)) == 0) {
+            continue;
+        }
+        auto& count{counts[digit]};
+
+        std::uint32_t offset{0};
+        for (auto& bucket : count) {
+            offset += std::exchange(bucket, offset);
+        }
+        for (auto const& entry : entries_) {
+            scratch_[count[(entry.key >> shift) & (bucket_count - 1)]++] = entry;
+        }
+        entries_.swap(scratch_);
+    }
+}
+
+}  // namespace Hazel
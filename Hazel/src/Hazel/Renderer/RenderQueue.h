@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace Hazel
+{
+// Deferred draw submissions, each identified by a 64-bit sort key and the index of its payload in a caller-owned
+// array. sort() orders the entries by key with an LSD radix sort - stable, so entries with equal keys keep their
+// submission order.
+class RenderQueue {
+public:
+    struct Entry {
+        std::uint64_t key;
+        std::uint32_t index;
+    };
+
+    using const_iterator = std::vector<Entry>::const_iterator;
+
+    // Sort key of a 2D draw, most significant field first:
+    //   opaque:      layer (8) | 0
+    //   translucent: layer (8) | 1 | depth (24, back to front)
+    // Opaque draws come first within a layer. Larger z is closer to the camera (see OrthographicCamera), the depth is
+    // the top 24 bits of z - translucent draws are ordered from the smallest z to the largest.
+    static std::uint64_t makeSortKey(std::uint8_t layer, bool translucent, float z) noexcept
+    {
+        auto const key{std::uint64_t{layer} << 56};
+        if (translucent) {
+            auto const depth{std::uint64_t{orderedBits(z) >> 8}};
+            return key | std::uint64_t{1} << 55 | depth << 31;
+        }
+        return key;
+    }
+
+    void push(std::uint64_t key, std::uint32_t index) { entries_.push_back(Entry{key, index}); }
+    void sort();
+    // Keeps the allocated storage for the next frame
+    void clear() noexcept { entries_.clear(); }
+
+    bool empty() const noexcept { return entries_.empty(); }
+    std::size_t size() const noexcept { return entries_.size(); }
+    const Entry& operator[](std::size_t i) const noexcept { return entries_[i]; }
+
+    const_iterator begin() const noexcept { return entries_.cbegin(); }
+    const_iterator end() const noexcept { return entries_.cend(); }
+
+private:
+    // Maps a float to an unsigned integer with the same ordering
+    static std::uint32_t orderedBits(float value) noexcept
+    {
+        std::uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        return (bits & 0x80000000u) != 0 ? ~bits : bits | 0x80000000u;
+    }
+
+    std::vector<Entry> entries_{};
+    std::vector<Entry> scratch_{};
+};
+} // namespace Hazel
@@ -1,22 +1,146 @@
 #include "Renderer2D.h"
 
-#include <glm/gtc/matrix_transform.hpp>
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+#include <vector>
 
+#include <glm/glm.hpp>
+
+#include "Hazel/Core/ThreadPool.h"
+#include "Hazel/Renderer/QuadKernels.h"
 #include "Hazel/Renderer/RenderCommand.h"
+#include "Hazel/Renderer/RenderQueue.h"
 #include "Hazel/Renderer/Shader.h"
 #include "Hazel/Renderer/VertexArray.h"
 #include "Platform/OpenGL/OpenGLShader.h"
 
 namespace Hazel {
 
-struct QuadVertex {
-    glm::vec3 position;
+// Texture slots of the current batch, keyed by the textures' renderer ids.
+// Open addressing with linear probing - entries stamped with an older generation count as empty,
+// so starting a new batch doesn't need to touch the entries at all.
+class TextureSlotTable {
+public:
+    static constexpr const std::uint32_t capacity_bits{6};
+    static constexpr const std::uint32_t capacity{1u << capacity_bits};
+    static constexpr const std::uint32_t not_found{~0u};
+
+    std::uint32_t find(std::uint32_t renderer_id) const noexcept
+    {
+        for (auto i{hash(renderer_id)};; i = (i + 1) & (capacity - 1)) {
+            auto const& entry{entries_[i]};
+            if (entry.generation != generation_) {
+                return not_found;
+            }
+            if (entry.renderer_id == renderer_id) {
+                return entry.slot;
+            }
+        }
+    }
+
+    // `renderer_id` must not be in the table yet
+    void insert(std::uint32_t renderer_id, std::uint32_t slot) noexcept
+    {
+        auto i{hash(renderer_id)};
+        while (entries_[i].generation == generation_) {
+            i = (i + 1) & (capacity - 1);
+        }
+        entries_[i] = Entry{renderer_id, slot, generation_};
+    }
+
+    void clear() noexcept
+    {
+        if (++generation_ == 0) {
+            // wrapped around - stale entries could alias the new generation
+            entries_.fill(Entry{});
+            generation_ = 1;
+        }
+    }
+
+private:
+    struct Entry {
+        std::uint32_t renderer_id{0};
+        std::uint32_t slot{0};
+        std::uint32_t generation{0};
+    };
+
+    static std::uint32_t hash(std::uint32_t renderer_id) noexcept
+    {
+        // Fibonacci hashing - renderer ids are mostly small consecutive integers
+        return (renderer_id * 2654435769u) >> (32 - capacity_bits);
+    }
+
+    std::array<Entry, capacity> entries_{};
+    std::uint32_t generation_{1};
+};
+
+// Per-quad record uploaded in QuadMode::Instanced - the vertex shader expands it into the unit quad
+struct QuadInstanceVertex {
+    glm::vec3 position;  // center of the quad
+    glm::vec2 x_axis;    // half-extent axes, already scaled and rotated
+    glm::vec2 y_axis;
     glm::vec4 color;
-    glm::vec2 tex_coord;
+    glm::vec4 tex_rect;  // {u_min, v_min, u_max, v_max}
     float tex_index;
     float tiling_factor;
 };
 
+// The xy part of the scene camera's view-projection, captured in Renderer2D::beginScene. A quad is visible if its
+// bounding box in clip space overlaps [-1, 1] x [-1, 1]. Orthographic cameras don't mix z into x and y.
+struct CullRect {
+    glm::vec2 x_row;  // clip x = dot(x_row, world xy) + offset.x
+    glm::vec2 y_row;
+    glm::vec2 offset;
+
+    explicit CullRect(const glm::mat4& view_projection = glm::mat4{1.0f}) noexcept
+        : x_row{view_projection[0][0], view_projection[1][0]},
+          y_row{view_projection[0][1], view_projection[1][1]},
+          offset{view_projection[3][0], view_projection[3][1]}
+    {
+    }
+
+    // `extent` is the half-size of the quad's bounding box in clip space
+    bool overlaps(const glm::vec3& center, float extent_x, float extent_y) const noexcept
+    {
+        auto const clip_x{x_row.x * center.x + x_row.y * center.y + offset.x};
+        auto const clip_y{y_row.x * center.x + y_row.y * center.y + offset.y};
+        return std::abs(clip_x) - extent_x <= 1.0f && std::abs(clip_y) - extent_y <= 1.0f;
+    }
+
+    // Quad spanned by the half-extent axes `x_axis` and `y_axis`
+    bool overlaps(const glm::vec3& center, const glm::vec3& x_axis, const glm::vec3& y_axis) const noexcept
+    {
+        return overlaps(center, std::abs(dot2(x_row, x_axis)) + std::abs(dot2(x_row, y_axis)),
+                        std::abs(dot2(y_row, x_axis)) + std::abs(dot2(y_row, y_axis)));
+    }
+
+    // Any quad within `radius` of `center` - conservative, but doesn't need the quad's orientation
+    bool overlaps(const glm::vec3& center, float radius) const noexcept
+    {
+        return overlaps(center, radius * std::sqrt(dot2(x_row, x_row)), radius * std::sqrt(dot2(y_row, y_row)));
+    }
+
+private:
+    template <typename Vec>
+    static float dot2(const glm::vec2& row, const Vec& v) noexcept
+    {
+        return row.x * v.x + row.y * v.y;
+    }
+};
+
+// A quad collected in Renderer2D::SubmitMode::Deferred, batched once the scene's quads are sorted
+struct DeferredQuad {
+    glm::vec3 center;
+    glm::vec3 x_axis;  // half-extent axes
+    glm::vec3 y_axis;
+    glm::vec4 color;
+    std::array<glm::vec2, 4> tex_coords;
+    std::uint32_t texture;  // index into Renderer2DData::deferred_textures
+    float tiling_factor;
+    float texture_index;  // slot in its batch, assigned once the quads are sorted
+};
+
 struct Renderer2DData {
     static constexpr const std::uint32_t max_quads{10'000};
     static constexpr const std::uint32_t quad_vertex_count{4};
@@ -25,29 +149,367 @@ struct Renderer2DData {
     static constexpr const std::uint32_t max_texture_slots{32};  // TODO: Renderer-capabilities
     static constexpr const std::uint32_t first_texture_index{1};
     static constexpr const std::uint32_t white_texture_index{0};
+    static constexpr const std::uint32_t instance_index_count{6};
+    // Smaller batches of deferred quads are expanded on the calling thread alone - waking the workers costs more
+    static constexpr const std::uint32_t min_parallel_quads{2048};
+    static constexpr const std::uint32_t min_parallel_chunk{512};
 
     Scope<VertexArray> quad_vertex_array;
     Ref<Shader> texture_shader;    // Used for both textures and flat colors
     Ref<Texture2D> white_texture;  // used to eliminate the texture component when using the shader as a flat-color
 
     std::uint32_t quad_index_count{0};
-    std::array<QuadVertex, max_vertices> quad_vertex_buffer_array;
+    // Quads are written straight into the currently mapped region of the streaming buffers
+    StreamingVertexBuffer* quad_vertex_stream{nullptr};  // owned by quad_vertex_array
+    QuadVertex* quad_vertex_buffer_base{nullptr};
     QuadVertex* quad_vertex_buffer_ptr{nullptr};
-    std::array<glm::vec4, 4> quad_vertex_positions;
+    QuadKernelInfo quad_kernel{};
+
+    Renderer2D::QuadMode quad_mode{Renderer2D::QuadMode::Batched};
+    Scope<VertexArray> instance_vertex_array;
+    Ref<Shader> instance_shader;
+    StreamingVertexBuffer* instance_stream{nullptr};  // owned by instance_vertex_array
+    QuadInstanceVertex* instance_buffer_base{nullptr};
+    QuadInstanceVertex* instance_buffer_ptr{nullptr};
+
+    Scope<VertexArray> compact_vertex_array;
+    Ref<Shader> compact_shader;
+    StreamingVertexBuffer* compact_vertex_stream{nullptr};  // owned by compact_vertex_array
+    CompactQuadVertex* compact_vertex_buffer_base{nullptr};
+    CompactQuadVertex* compact_vertex_buffer_ptr{nullptr};
 
     std::array<Ref<Texture2D>, max_texture_slots> texture_slots;
     std::uint32_t texture_slot_index{first_texture_index};  // 0 == white texture
+    TextureSlotTable texture_slot_table;
+    // Consecutive quads mostly share a texture - skips the table lookup (and the virtual getRendererId call).
+    // Always one of texture_slots, so it can't dangle.
+    const Texture2D* last_texture{nullptr};
+    float last_texture_index{0.0f};
+
+    glm::mat4 view_projection{1.0f};  // of the current scene
+    bool culling{false};
+    CullRect cull_rect;
+    std::vector<QuadInstance> visible_instances;  // drawQuads input left after culling
+
+    Renderer2D::SubmitMode submit_mode{Renderer2D::SubmitMode::Immediate};
+    std::uint8_t layer{0};
+    std::vector<DeferredQuad> deferred_quads;
+    RenderQueue render_queue;
+    // Textures of the deferred quads - each quad holds an index instead of a reference of its own
+    std::vector<Ref<Texture2D>> deferred_textures;
+    std::unordered_map<const Texture2D*, std::uint32_t> deferred_texture_ids;
+    const Texture2D* last_deferred_texture{nullptr};
+    std::uint32_t last_deferred_texture_id{0};
+    Scope<ThreadPool> vertex_workers;
 
     Renderer2D::Statistics stats;
 };
+
+// StaticBatch segments use every slot but the white texture's
+static_assert(StaticBatch::max_segment_textures == Renderer2DData::max_texture_slots - 1);
+// Keeps the slot table at most half full, so that probe sequences stay short
+static_assert(TextureSlotTable::capacity >= 2 * Renderer2DData::max_texture_slots);
+// The SIMD quad kernels use 16-byte streaming stores - every region has to start 16-byte aligned
+static_assert((Renderer2DData::max_vertices * sizeof(QuadVertex)) % 16 == 0);
+static_assert((Renderer2DData::max_vertices * sizeof(CompactQuadVertex)) % 16 == 0);
 }  // namespace Hazel
 
 namespace {
 ::Hazel::Renderer2DData s_data;
 
-inline void increment_quad_index() noexcept
+// Corners of a quad in the order expected by the index buffer:
+// bottom-left, bottom-right, top-right, top-left
+using QuadCorners = std::array<glm::vec3, ::Hazel::Renderer2DData::quad_vertex_count>;
+using QuadTexCoords = std::array<glm::vec2, ::Hazel::Renderer2DData::quad_vertex_count>;
+
+const QuadTexCoords quad_tex_coords{{{0.0f, 0.0f}, {1.0f, 0.0f}, {1.0f, 1.0f}, {0.0f, 1.0f}}};
+
+// Builds the corners of a quad centered at `center`, spanned by the half-extent axes `x_axis` and `y_axis`
+inline QuadCorners make_corners(const glm::vec3& center, const glm::vec3& x_axis, const glm::vec3& y_axis) noexcept
 {
-    s_data.quad_index_count += 6;  // why +6?
+    return {{center - x_axis - y_axis, center + x_axis - y_axis, center + x_axis + y_axis, center - x_axis + y_axis}};
+}
+
+// Center and half-extent axes of a quad, as uploaded in QuadMode::Instanced and collected in SubmitMode::Deferred
+struct QuadAxes {
+    glm::vec3 center;
+    glm::vec3 x_axis;
+    glm::vec3 y_axis;
+};
+
+// Quad geometry descriptions - each one can produce either the corners written in QuadMode::Batched
+// or the axes written in QuadMode::Instanced, so that only the representation in use gets computed
+
+// Equivalent to transforming the unit quad by translate(position) * scale(size), without building the matrix
+struct AxisAlignedQuad {
+    const glm::vec3& position;
+    const glm::vec2& size;
+
+    QuadCorners corners() const noexcept
+    {
+        auto const half_width{size.x * 0.5f};
+        auto const half_height{size.y * 0.5f};
+        return {{{position.x - half_width, position.y - half_height, position.z},
+                 {position.x + half_width, position.y - half_height, position.z},
+                 {position.x + half_width, position.y + half_height, position.z},
+                 {position.x - half_width, position.y + half_height, position.z}}};
+    }
+
+    QuadAxes axes() const noexcept
+    {
+        return {position, {size.x * 0.5f, 0.0f, 0.0f}, {0.0f, size.y * 0.5f, 0.0f}};
+    }
+
+    bool visible(const ::Hazel::CullRect& rect) const noexcept
+    {
+        auto const a{axes()};
+        return rect.overlaps(a.center, a.x_axis, a.y_axis);
+    }
+};
+
+// Equivalent to transforming the unit quad by translate(position) * rotate(rotation, z) * scale(size)
+struct RotatedQuad {
+    const glm::vec3& position;
+    const glm::vec2& size;
+    float rotation;
+
+    QuadCorners corners() const noexcept
+    {
+        auto const a{axes()};
+        return make_corners(position, a.x_axis, a.y_axis);
+    }
+
+    QuadAxes axes() const noexcept
+    {
+        auto const c{std::cos(rotation)};
+        auto const s{std::sin(rotation)};
+        auto const half_width{size.x * 0.5f};
+        auto const half_height{size.y * 0.5f};
+        return {position, {c * half_width, s * half_width, 0.0f}, {-s * half_height, c * half_height, 0.0f}};
+    }
+
+    // Bounding circle - culled quads don't pay for the sine and cosine
+    bool visible(const ::Hazel::CullRect& rect) const noexcept
+    {
+        return rect.overlaps(position, 0.5f * std::sqrt(size.x * size.x + size.y * size.y));
+    }
+};
+
+// The unit quad's corners are (+-0.5, +-0.5, 0, 1), so transforming them only needs
+// the translation column and half of the first two basis columns
+struct TransformedQuad {
+    const glm::mat4& transform;
+
+    QuadCorners corners() const noexcept
+    {
+        return make_corners(glm::vec3{transform[3]}, glm::vec3{transform[0]} * 0.5f, glm::vec3{transform[1]} * 0.5f);
+    }
+
+    QuadAxes axes() const noexcept
+    {
+        return {glm::vec3{transform[3]}, glm::vec3{transform[0]} * 0.5f, glm::vec3{transform[1]} * 0.5f};
+    }
+
+    bool visible(const ::Hazel::CullRect& rect) const noexcept
+    {
+        auto const a{axes()};
+        return rect.overlaps(a.center, a.x_axis, a.y_axis);
+    }
+};
+
+struct DeferredGeometry {
+    const ::Hazel::DeferredQuad& quad;
+
+    QuadCorners corners() const noexcept { return make_corners(quad.center, quad.x_axis, quad.y_axis); }
+    QuadAxes axes() const noexcept { return {quad.center, quad.x_axis, quad.y_axis}; }
+};
+
+// Texture coordinates of the axis-aligned rectangle spanned by `uv_min` and `uv_max`
+inline QuadTexCoords rect_tex_coords(const glm::vec2& uv_min, const glm::vec2& uv_max) noexcept
+{
+    return {{uv_min, {uv_max.x, uv_min.y}, uv_max, {uv_min.x, uv_max.y}}};
+}
+
+inline void write_vertices(::Hazel::QuadVertex* vertex, const QuadCorners& corners, const glm::vec4& color,
+                           const QuadTexCoords& tex_coords, float texture_index, float tiling_factor) noexcept
+{
+    for (std::uint32_t i{0}; i != ::Hazel::Renderer2DData::quad_vertex_count; ++i, ++vertex) {
+        vertex->position = corners[i];
+        vertex->color = color;
+        vertex->tex_coord = tex_coords[i];
+        vertex->tex_index = texture_index;
+        vertex->tiling_factor = tiling_factor;
+    }
+}
+
+// Quantization of the CompactQuadVertex attributes.
+// std::min / std::max instead of std::clamp - they compile to branchless minss / maxss.
+inline float saturate(float value) noexcept { return std::min(std::max(value, 0.0f), 1.0f); }
+
+inline std::uint32_t pack_unorm8(float value) noexcept
+{
+    return static_cast<std::uint32_t>(saturate(value) * 255.0f + 0.5f);
+}
+
+inline std::uint32_t pack_color(const glm::vec4& color) noexcept
+{
+    return pack_unorm8(color.r) | pack_unorm8(color.g) << 8 | pack_unorm8(color.b) << 16 | pack_unorm8(color.a) << 24;
+}
+
+inline std::uint16_t pack_unorm16(float value) noexcept
+{
+    return static_cast<std::uint16_t>(saturate(value) * 65535.0f + 0.5f);
+}
+
+inline std::uint32_t pack_texture(float texture_index, float tiling_factor) noexcept
+{
+    // the tiling factor is capped so that the packed value stays positive as a GLSL int
+    constexpr float max_tiling{static_cast<float>((1u << 23) - 1)};
+    auto const tiling{static_cast<std::uint32_t>(std::min(std::max(tiling_factor * 256.0f + 0.5f, 0.0f), max_tiling))};
+    return static_cast<std::uint32_t>(texture_index) | tiling << 8;
+}
+
+using PackedTexCoords = std::array<std::array<std::uint16_t, 2>, ::Hazel::Renderer2DData::quad_vertex_count>;
+
+inline PackedTexCoords pack_tex_coords(const QuadTexCoords& tex_coords) noexcept
+{
+    PackedTexCoords packed;
+    for (std::uint32_t i{0}; i != ::Hazel::Renderer2DData::quad_vertex_count; ++i) {
+        packed[i] = {pack_unorm16(tex_coords[i].x), pack_unorm16(tex_coords[i].y)};
+    }
+    return packed;
+}
+
+const PackedTexCoords packed_quad_tex_coords{pack_tex_coords(quad_tex_coords)};
+
+inline void write_compact_vertices(::Hazel::CompactQuadVertex* vertex, const QuadCorners& corners,
+                                   const glm::vec4& color, const QuadTexCoords& tex_coords, float texture_index,
+                                   float tiling_factor) noexcept
+{
+    auto const packed_color{pack_color(color)};
+    auto const packed_texture{pack_texture(texture_index, tiling_factor)};
+    // Untextured and whole-texture quads all share quad_tex_coords - only subtextures need quantizing
+    auto const packed_tex_coords{&tex_coords == &quad_tex_coords ? packed_quad_tex_coords
+                                                                 : pack_tex_coords(tex_coords)};
+    for (std::uint32_t i{0}; i != ::Hazel::Renderer2DData::quad_vertex_count; ++i, ++vertex) {
+        vertex->position = corners[i];
+        vertex->color = packed_color;
+        vertex->tex_coord = packed_tex_coords[i];
+        vertex->texture = packed_texture;
+    }
+}
+
+inline void write_instance(::Hazel::QuadInstanceVertex* instance, const QuadAxes& axes, const glm::vec4& color,
+                           const glm::vec4& tex_rect, float texture_index, float tiling_factor) noexcept
+{
+    // The instanced shader expands quads in the xy plane - the z components of the axes are dropped
+    *instance = {axes.center, glm::vec2{axes.x_axis}, glm::vec2{axes.y_axis}, color, tex_rect, texture_index,
+                 tiling_factor};
+}
+
+// Writes a quad in the representation of the current QuadMode, `offset` quads past the end of the current batch.
+// Doesn't modify the renderer state, so that disjoint offsets can be written from several threads at once.
+template <typename Quad>
+inline void write_quad_at(std::size_t offset, const Quad& quad, const glm::vec4& color,
+                          const QuadTexCoords& tex_coords, float texture_index, float tiling_factor) noexcept
+{
+    constexpr auto vertex_count{::Hazel::Renderer2DData::quad_vertex_count};
+    switch (s_data.quad_mode) {
+    case ::Hazel::Renderer2D::QuadMode::Batched:
+        write_vertices(s_data.quad_vertex_buffer_ptr + offset * vertex_count, quad.corners(), color, tex_coords,
+                       texture_index, tiling_factor);
+        break;
+    case ::Hazel::Renderer2D::QuadMode::Instanced:
+        // texture coordinates are always an axis-aligned rectangle - see SubTexture2D
+        write_instance(s_data.instance_buffer_ptr + offset, quad.axes(), color, {tex_coords[0], tex_coords[2]},
+                       texture_index, tiling_factor);
+        break;
+    case ::Hazel::Renderer2D::QuadMode::Compact:
+        write_compact_vertices(s_data.compact_vertex_buffer_ptr + offset * vertex_count, quad.corners(), color,
+                               tex_coords, texture_index, tiling_factor);
+        break;
+    }
+}
+
+// Appends `count` quads written with write_quad_at to the current batch
+inline void advance_quads(std::uint32_t count) noexcept
+{
+    switch (s_data.quad_mode) {
+    case ::Hazel::Renderer2D::QuadMode::Batched:
+        s_data.quad_vertex_buffer_ptr += count * ::Hazel::Renderer2DData::quad_vertex_count;
+        break;
+    case ::Hazel::Renderer2D::QuadMode::Instanced:
+        s_data.instance_buffer_ptr += count;
+        break;
+    case ::Hazel::Renderer2D::QuadMode::Compact:
+        s_data.compact_vertex_buffer_ptr += count * ::Hazel::Renderer2DData::quad_vertex_count;
+        break;
+    }
+
+    s_data.quad_index_count += count * 6;
+    s_data.stats.quad_count += count;
+}
+
+template <typename Quad>
+inline void write_quad(const Quad& quad, const glm::vec4& color, const QuadTexCoords& tex_coords,
+                       float texture_index, float tiling_factor) noexcept
+{
+    write_quad_at(0, quad, color, tex_coords, texture_index, tiling_factor);
+    advance_quads(1);
+}
+
+inline std::uint32_t deferred_texture_id(const ::Hazel::Ref<::Hazel::Texture2D>& texture)
+{
+    if (texture.get() == s_data.last_deferred_texture) {
+        return s_data.last_deferred_texture_id;
+    }
+
+    auto const [it, inserted]{s_data.deferred_texture_ids.try_emplace(
+        texture.get(), static_cast<std::uint32_t>(s_data.deferred_textures.size()))};
+    if (inserted) {
+        s_data.deferred_textures.push_back(texture);
+    }
+    s_data.last_deferred_texture = texture.get();
+    s_data.last_deferred_texture_id = it->second;
+    return it->second;
+}
+
+// Queues a quad under the sort key of RenderQueue::makeSortKey. Only flat-colored quads without alpha are opaque - the
+// texture shaders never discard, so even the transparent texels of a textured quad write depth and it has to be
+// blended back to front like any translucent one. The sort is stable, quads with equal keys keep their submission
+// order - the same quad wins an equal-depth overlap as in SubmitMode::Immediate. Batches aren't broken by texture
+// changes until the slots run out, so grouping by texture would buy little.
+template <typename Quad>
+inline void defer_quad(const Quad& quad, const glm::vec4& color, const QuadTexCoords& tex_coords,
+                       const ::Hazel::Ref<::Hazel::Texture2D>& texture, float tiling_factor)
+{
+    auto const axes{quad.axes()};
+    auto const texture_id{deferred_texture_id(texture)};
+    auto const index{static_cast<std::uint32_t>(s_data.deferred_quads.size())};
+    s_data.deferred_quads.push_back(
+        {axes.center, axes.x_axis, axes.y_axis, color, tex_coords, texture_id, tiling_factor, 0.0f});
+    auto const translucent{color.a < 1.0f || texture != s_data.white_texture};
+    s_data.render_queue.push(RenderQueue::makeSortKey(s_data.layer, translucent, axes.center.z), index);
+}
+
+// Writes the sorted deferred quads [begin, end) into the current batch, which must have room for them
+inline void expand_deferred(std::size_t begin, std::size_t end)
+{
+    auto const expand{[begin](std::size_t chunk_begin, std::size_t chunk_end) {
+        for (auto i{chunk_begin}; i != chunk_end; ++i) {
+            auto const& quad{s_data.deferred_quads[s_data.render_queue[begin + i].index]};
+            write_quad_at(i, DeferredGeometry{quad}, quad.color, quad.tex_coords, quad.texture_index,
+                          quad.tiling_factor);
+        }
+    }};
+
+    auto const count{end - begin};
+    if (s_data.vertex_workers && count >= ::Hazel::Renderer2DData::min_parallel_quads) {
+        s_data.vertex_workers->parallelFor(count, ::Hazel::Renderer2DData::min_parallel_chunk, expand);
+    } else {
+        expand(0, count);
+    }
+    advance_quads(static_cast<std::uint32_t>(count));
 }
 }  // namespace
 
@@ -56,12 +518,13 @@ void Renderer2D::init()
 {
     HZ_PROFILE_FUNCTION();
     s_data.quad_vertex_array = VertexArray::create();
-    auto quad_vertex_buffer = VertexBuffer::create(s_data.max_vertices * sizeof(QuadVertex));
+    auto quad_vertex_buffer = StreamingVertexBuffer::create(s_data.max_vertices * sizeof(QuadVertex));
     quad_vertex_buffer->setLayout({{ShaderDataType::Float3, "a_position"},
                                    {ShaderDataType::Float4, "a_color"},
                                    {ShaderDataType::Float2, "a_tex_coord"},
                                    {ShaderDataType::Float, "a_tex_index"},
                                    {ShaderDataType::Float, "a_tiling_factor"}});
+    s_data.quad_vertex_stream = quad_vertex_buffer.get();
     s_data.quad_vertex_array->addVertexBuffer(std::move(quad_vertex_buffer));
 
     constexpr auto quad_indices = []() constexpr
@@ -85,6 +548,17 @@ void Renderer2D::init()
 
     s_data.quad_vertex_array->setIndexBuffer(IndexBuffer::create(quad_indices));
 
+    // QuadMode::Compact - same indices, quantized vertices
+    s_data.compact_vertex_array = VertexArray::create();
+    auto compact_vertex_buffer = StreamingVertexBuffer::create(s_data.max_vertices * sizeof(CompactQuadVertex));
+    compact_vertex_buffer->setLayout({{ShaderDataType::Float3, "a_position"},
+                                      {ShaderDataType::UByte4, "a_color", true},
+                                      {ShaderDataType::UShort2, "a_tex_coord", true},
+                                      {ShaderDataType::Int, "a_texture"}});
+    s_data.compact_vertex_stream = compact_vertex_buffer.get();
+    s_data.compact_vertex_array->addVertexBuffer(std::move(compact_vertex_buffer));
+    s_data.compact_vertex_array->setIndexBuffer(IndexBuffer::create(quad_indices));
+
     s_data.white_texture = Texture2D::create(1, 1);
     const unsigned white_texture_data{0xffffffff};
     s_data.white_texture->setData(&white_texture_data, sizeof(white_texture_data));
@@ -102,10 +576,34 @@ void Renderer2D::init()
     s_data.texture_shader->setUniform("u_textures", tex_samplers.data(),
                                       static_cast<std::uint32_t>(tex_samplers.size()));
 
-    s_data.quad_vertex_positions[0] = {-0.5f, -0.5f, 0.0f, 1.0f};
-    s_data.quad_vertex_positions[1] = {0.5f, -0.5f, 0.0f, 1.0f};
-    s_data.quad_vertex_positions[2] = {0.5f, 0.5f, 0.0f, 1.0f};
-    s_data.quad_vertex_positions[3] = {-0.5f, 0.5f, 0.0f, 1.0f};
+    // QuadMode::Instanced - a single quad's worth of indices, drawn once per uploaded QuadInstanceVertex
+    s_data.instance_vertex_array = VertexArray::create();
+    auto instance_buffer = StreamingVertexBuffer::create(s_data.max_quads * sizeof(QuadInstanceVertex));
+    instance_buffer->setLayout({{{ShaderDataType::Float3, "a_position"},
+                                 {ShaderDataType::Float2, "a_x_axis"},
+                                 {ShaderDataType::Float2, "a_y_axis"},
+                                 {ShaderDataType::Float4, "a_color"},
+                                 {ShaderDataType::Float4, "a_tex_rect"},
+                                 {ShaderDataType::Float, "a_tex_index"},
+                                 {ShaderDataType::Float, "a_tiling_factor"}},
+                                VertexStepRate::PerInstance});
+    s_data.instance_stream = instance_buffer.get();
+    s_data.instance_vertex_array->addVertexBuffer(std::move(instance_buffer));
+    constexpr std::array<std::uint32_t, Renderer2DData::instance_index_count> instance_indices{0, 1, 2, 2, 3, 0};
+    s_data.instance_vertex_array->setIndexBuffer(IndexBuffer::create(instance_indices));
+
+    s_data.instance_shader = Shader::create("assets/shaders/QuadInstanced.glsl");
+    s_data.instance_shader->bind();
+    s_data.instance_shader->setUniform("u_textures", tex_samplers.data(),
+                                       static_cast<std::uint32_t>(tex_samplers.size()));
+
+    s_data.compact_shader = Shader::create("assets/shaders/TextureCompact.glsl");
+    s_data.compact_shader->bind();
+    s_data.compact_shader->setUniform("u_textures", tex_samplers.data(),
+                                      static_cast<std::uint32_t>(tex_samplers.size()));
+
+    s_data.quad_kernel = selectQuadKernel();
+    HZ_CORE_INFO("Renderer2D: using the {} quad vertex kernel", s_data.quad_kernel.name);
 }
 
 void Renderer2D::shutdown() { HZ_PROFILE_FUNCTION(); }
@@ -113,10 +611,18 @@ void Renderer2D::shutdown() { HZ_PROFILE_FUNCTION(); }
 inline void Renderer2D::resetDrawBuffers() noexcept
 {
     s_data.quad_index_count = 0;
-    s_data.quad_vertex_buffer_ptr = s_data.quad_vertex_buffer_array.data();
+    s_data.quad_vertex_buffer_base = static_cast<QuadVertex*>(s_data.quad_vertex_stream->map());
+    s_data.quad_vertex_buffer_ptr = s_data.quad_vertex_buffer_base;
+    s_data.instance_buffer_base = static_cast<QuadInstanceVertex*>(s_data.instance_stream->map());
+    s_data.instance_buffer_ptr = s_data.instance_buffer_base;
+    s_data.compact_vertex_buffer_base = static_cast<CompactQuadVertex*>(s_data.compact_vertex_stream->map());
+    s_data.compact_vertex_buffer_ptr = s_data.compact_vertex_buffer_base;
 
     s_data.texture_slot_index = s_data.first_texture_index;
     s_data.texture_slots[s_data.white_texture_index] = s_data.white_texture;
+    s_data.texture_slot_table.clear();
+    s_data.texture_slot_table.insert(s_data.white_texture->getRendererId(), s_data.white_texture_index);
+    s_data.last_texture = nullptr;
 }
 
 void Renderer2D::beginScene(const OrthographicCamera& camera)
@@ -125,6 +631,14 @@ void Renderer2D::beginScene(const OrthographicCamera& camera)
     auto& ts{*s_data.texture_shader};
     ts.bind();
     ts.setUniform("u_view_projection", camera.getViewProjection());
+    auto& is{*s_data.instance_shader};
+    is.bind();
+    is.setUniform("u_view_projection", camera.getViewProjection());
+    auto& cs{*s_data.compact_shader};
+    cs.bind();
+    cs.setUniform("u_view_projection", camera.getViewProjection());
+    s_data.view_projection = camera.getViewProjection();
+    s_data.cull_rect = CullRect{camera.getViewProjection()};
 
     resetDrawBuffers();
 }
@@ -136,7 +650,35 @@ inline void Renderer2D::flush()
         for (std::uint32_t i{0}; i != s_data.texture_slot_index; ++i) {
             s_data.texture_slots[i]->bind(i);
         }
-        RenderCommand::drawIndexed(*s_data.quad_vertex_array, s_data.quad_index_count);
+        switch (s_data.quad_mode) {
+        case QuadMode::Batched: {
+            s_data.texture_shader->bind();
+            s_data.quad_vertex_array->bind();
+            auto const base_vertex{
+                static_cast<std::uint32_t>(s_data.quad_vertex_stream->getRegionOffset() / sizeof(QuadVertex))};
+            RenderCommand::drawIndexed(*s_data.quad_vertex_array, s_data.quad_index_count, base_vertex);
+            break;
+        }
+        case QuadMode::Instanced: {
+            s_data.instance_shader->bind();
+            s_data.instance_vertex_array->bind();
+            auto const instance_count{
+                static_cast<std::uint32_t>(s_data.instance_buffer_ptr - s_data.instance_buffer_base)};
+            auto const base_instance{
+                static_cast<std::uint32_t>(s_data.instance_stream->getRegionOffset() / sizeof(QuadInstanceVertex))};
+            RenderCommand::drawIndexedInstanced(*s_data.instance_vertex_array, Renderer2DData::instance_index_count,
+                                                instance_count, base_instance);
+            break;
+        }
+        case QuadMode::Compact: {
+            s_data.compact_shader->bind();
+            s_data.compact_vertex_array->bind();
+            auto const base_vertex{static_cast<std::uint32_t>(s_data.compact_vertex_stream->getRegionOffset() /
+                                                              sizeof(CompactQuadVertex))};
+            RenderCommand::drawIndexed(*s_data.compact_vertex_array, s_data.quad_index_count, base_vertex);
+            break;
+        }
+        }
         ++s_data.stats.draw_calls;
     }
 }
@@ -144,56 +686,209 @@ inline void Renderer2D::flush()
 void Renderer2D::endScene()
 {
     HZ_PROFILE_FUNCTION();
+    submitDeferred();
+    drawBatch();
+
+    // Nothing is batched until the next beginScene maps the streams again - otherwise a setQuadMode (or static
+    // batch, or instanced draw) after the scene would draw its quads a second time, from a region since advanced
+    s_data.quad_index_count = 0;
+    s_data.quad_vertex_buffer_ptr = s_data.quad_vertex_buffer_base;
+    s_data.instance_buffer_ptr = s_data.instance_buffer_base;
+    s_data.compact_vertex_buffer_ptr = s_data.compact_vertex_buffer_base;
+}
 
-    auto const data_size{
-        static_cast<std::uint32_t>((s_data.quad_vertex_buffer_ptr - s_data.quad_vertex_buffer_array.data()) *
-                                   sizeof(s_data.quad_vertex_buffer_array.front()))};
-    s_data.quad_vertex_array->getVertexBuffers().back()->setData(s_data.quad_vertex_buffer_array.data(), data_size);
+inline void Renderer2D::drawBatch()
+{
+    StreamingVertexBuffer* stream{nullptr};
+    std::size_t data_size{0};
+    switch (s_data.quad_mode) {
+    case QuadMode::Batched:
+        stream = s_data.quad_vertex_stream;
+        data_size = (s_data.quad_vertex_buffer_ptr - s_data.quad_vertex_buffer_base) * sizeof(QuadVertex);
+        break;
+    case QuadMode::Instanced:
+        stream = s_data.instance_stream;
+        data_size = (s_data.instance_buffer_ptr - s_data.instance_buffer_base) * sizeof(QuadInstanceVertex);
+        break;
+    case QuadMode::Compact:
+        stream = s_data.compact_vertex_stream;
+        data_size = (s_data.compact_vertex_buffer_ptr - s_data.compact_vertex_buffer_base) * sizeof(CompactQuadVertex);
+        break;
+    }
+    stream->commit(static_cast<std::uint32_t>(data_size));
 
     flush();
+    // The next batch is written to a different region while the GPU reads this one
+    stream->advance();
+}
+
+inline void Renderer2D::nextBatch()
+{
+    drawBatch();
+    resetDrawBuffers();
 }
 
 inline void Renderer2D::checkAndFlush() noexcept
 {
     if (s_data.quad_index_count >= Renderer2DData::max_indices) {
-        endScene();
-        resetDrawBuffers();
+        nextBatch();
     }
 }
 
-// primitives
-void Renderer2D::drawQuad(const glm::vec2& position, const glm::vec2& size, const glm::vec4& color)
+inline float Renderer2D::getTextureIndex(const Ref<Texture2D>& texture)
 {
-    drawQuad({position.x, position.y, 0.0f}, size, color);
+    if (auto const texture_index{findTextureIndex(texture)}) {
+        return *texture_index;
+    }
+
+    // Every slot is taken - draw what has been batched so far and start over with just the white texture
+    nextBatch();
+    ++s_data.stats.texture_batch_breaks;
+    return *findTextureIndex(texture);
 }
 
-void Renderer2D::drawQuad(const glm::vec3& position, const glm::vec2& size, const glm::vec4& color)
+inline std::optional<float> Renderer2D::findTextureIndex(const Ref<Texture2D>& texture) noexcept
 {
-    HZ_PROFILE_FUNCTION();
+    if (texture.get() == s_data.last_texture) {
+        return s_data.last_texture_index;
+    }
+
+    auto const renderer_id{texture->getRendererId()};
+    auto slot{s_data.texture_slot_table.find(renderer_id)};
+    if (slot == TextureSlotTable::not_found) {
+        if (s_data.texture_slot_index == Renderer2DData::max_texture_slots) {
+            return std::nullopt;
+        }
+        slot = s_data.texture_slot_index++;
+        s_data.texture_slots[slot] = texture;
+        s_data.texture_slot_table.insert(renderer_id, slot);
+    }
+
+    s_data.last_texture = texture.get();
+    s_data.last_texture_index = static_cast<float>(slot);
+    return s_data.last_texture_index;
+}
+
+void Renderer2D::setQuadMode(QuadMode mode)
+{
+    if (mode == s_data.quad_mode) {
+        return;
+    }
+    // Quads already submitted in the previous mode are drawn before switching
+    submitDeferred();
+    if (s_data.quad_index_count != 0) {
+        nextBatch();
+    }
+    s_data.quad_mode = mode;
+}
+
+Renderer2D::QuadMode Renderer2D::getQuadMode() noexcept { return s_data.quad_mode; }
+
+void Renderer2D::setSubmitMode(SubmitMode mode)
+{
+    if (mode == s_data.submit_mode) {
+        return;
+    }
+    submitDeferred();
+    s_data.submit_mode = mode;
+}
+
+Renderer2D::SubmitMode Renderer2D::getSubmitMode() noexcept { return s_data.submit_mode; }
+
+void Renderer2D::setLayer(std::uint8_t layer) noexcept { s_data.layer = layer; }
+
+std::uint8_t Renderer2D::getLayer() noexcept { return s_data.layer; }
+
+void Renderer2D::setCulling(bool enabled) noexcept { s_data.culling = enabled; }
+
+bool Renderer2D::isCullingEnabled() noexcept { return s_data.culling; }
+
+void Renderer2D::setWorkerThreadCount(std::uint32_t count)
+{
+    if (count == getWorkerThreadCount()) {
+        return;
+    }
+    s_data.vertex_workers.reset();
+    if (count != 0) {
+        s_data.vertex_workers = makeScope<ThreadPool>(count);
+    }
+}
+
+std::uint32_t Renderer2D::getWorkerThreadCount() noexcept
+{
+    return s_data.vertex_workers ? s_data.vertex_workers->getWorkerCount() : 0;
+}
+
+template <typename Quad>
+inline void Renderer2D::submitQuad(const Quad& quad, const glm::vec4& color,
+                                   const std::array<glm::vec2, 4>& tex_coords, const Ref<Texture2D>& texture,
+                                   float tiling_factor)
+{
+    if (s_data.culling && !quad.visible(s_data.cull_rect)) {
+        ++s_data.stats.culled_quad_count;
+        return;
+    }
+    if (s_data.submit_mode == SubmitMode::Deferred) {
+        defer_quad(quad, color, tex_coords, texture, tiling_factor);
+        return;
+    }
 
     checkAndFlush();
+    auto const texture_index{texture == s_data.white_texture ? static_cast<float>(Renderer2DData::white_texture_index)
+                                                             : getTextureIndex(texture)};
+    write_quad(quad, color, tex_coords, texture_index, tiling_factor);
+}
+
+void Renderer2D::submitDeferred()
+{
+    if (s_data.render_queue.empty()) {
+        return;
+    }
+    HZ_PROFILE_FUNCTION();
 
-    const glm::mat4 transform{glm::translate(glm::mat4(1.0f), position) *
-                              glm::scale(glm::mat4(1.0f), {size.x, size.y, 1.0f})};
+    s_data.render_queue.sort();
+
+    // Batch boundaries and texture slots are decided up front, so that each batch's quads can then be expanded
+    // independently of each other - possibly on several threads
+    auto const count{s_data.render_queue.size()};
+    std::size_t batch_begin{0};
+    for (std::size_t i{0}; i != count; ++i) {
+        auto& quad{s_data.deferred_quads[s_data.render_queue[i].index]};
+        auto const& texture{s_data.deferred_textures[quad.texture]};
+
+        auto const batch_full{s_data.quad_index_count + (i - batch_begin) * 6 >= Renderer2DData::max_indices};
+        auto texture_index{batch_full ? std::nullopt : findTextureIndex(texture)};
+        if (!texture_index) {
+            expand_deferred(batch_begin, i);
+            nextBatch();
+            if (!batch_full) {
+                ++s_data.stats.texture_batch_breaks;
+            }
+            batch_begin = i;
+            texture_index = findTextureIndex(texture);
+        }
+        quad.texture_index = *texture_index;
+    }
+    expand_deferred(batch_begin, count);
 
-    auto const fill_buffer = [&transform, &color](glm::vec4 const& pos, glm::vec2 tx_crd) noexcept {
-        constexpr float tiling_factor{1.0f};
+    s_data.render_queue.clear();
+    s_data.deferred_quads.clear();
+    s_data.deferred_textures.clear();
+    s_data.deferred_texture_ids.clear();
+    s_data.last_deferred_texture = nullptr;
+}
 
-        s_data.quad_vertex_buffer_ptr->position = transform * pos;
-        s_data.quad_vertex_buffer_ptr->color = color;
-        s_data.quad_vertex_buffer_ptr->tex_coord = tx_crd;
-        s_data.quad_vertex_buffer_ptr->tex_index = s_data.white_texture_index;
-        s_data.quad_vertex_buffer_ptr->tiling_factor = tiling_factor;
-        ++s_data.quad_vertex_buffer_ptr;
-    };
+// primitives
+void Renderer2D::drawQuad(const glm::vec2& position, const glm::vec2& size, const glm::vec4& color)
+{
+    drawQuad({position.x, position.y, 0.0f}, size, color);
+}
 
-    fill_buffer(s_data.quad_vertex_positions[0], {0.0f, 0.0f});
-    fill_buffer(s_data.quad_vertex_positions[1], {1.0f, 0.0f});
-    fill_buffer(s_data.quad_vertex_positions[2], {1.0f, 1.0f});
-    fill_buffer(s_data.quad_vertex_positions[3], {0.0f, 1.0f});
+void Renderer2D::drawQuad(const glm::vec3& position, const glm::vec2& size, const glm::vec4& color)
+{
+    HZ_PROFILE_FUNCTION();
 
-    increment_quad_index();
-    ++s_data.stats.quad_count;
+    submitQuad(AxisAlignedQuad{position, size}, color, quad_tex_coords, s_data.white_texture, 1.0f);
 }
 
 void Renderer2D::drawQuad(const glm::vec2& position, const glm::vec2& size, const Ref<Texture2D>& texture,
@@ -207,46 +902,7 @@ void Renderer2D::drawQuad(const glm::vec3& position, const glm::vec2& size, cons
 {
     HZ_PROFILE_FUNCTION();
 
-    checkAndFlush();
-
-    auto const texture_index = [&texture]() noexcept {
-        for (std::uint32_t i{0}; i != s_data.texture_slot_index; ++i) {
-            if (*s_data.texture_slots[i] == *texture) {
-                return static_cast<float>(i);
-            }
-        }
-        return static_cast<float>(s_data.texture_slot_index);
-    }();
-
-    // If texture not found
-    if (static_cast<const std::uint32_t>(texture_index) == s_data.texture_slot_index) {
-        if (s_data.texture_slot_index >= Renderer2DData::max_texture_slots) {
-            checkAndFlush();
-        }
-        HZ_ASSERT(s_data.texture_slot_index != s_data.max_texture_slots, "Maximum texture slots exceeded");
-        s_data.texture_slots[static_cast<const std::uint32_t>(texture_index)] = texture;
-        ++s_data.texture_slot_index;
-    }
-
-    const glm::mat4 transform{glm::translate(glm::mat4(1.0f), position) *
-                              glm::scale(glm::mat4(1.0f), {size.x, size.y, 1.0f})};
-
-    auto const fill_buffer = [&transform, &tint_color, texture_index, tiling_factor](glm::vec4 const& pos,
-                                                                                     glm::vec2 tx_crd) noexcept {
-        s_data.quad_vertex_buffer_ptr->position = transform * pos;
-        s_data.quad_vertex_buffer_ptr->color = tint_color;
-        s_data.quad_vertex_buffer_ptr->tex_coord = tx_crd;
-        s_data.quad_vertex_buffer_ptr->tex_index = texture_index;
-        s_data.quad_vertex_buffer_ptr->tiling_factor = tiling_factor;
-        ++s_data.quad_vertex_buffer_ptr;
-    };
-    fill_buffer(s_data.quad_vertex_positions[0], {0.0f, 0.0f});
-    fill_buffer(s_data.quad_vertex_positions[1], {1.0f, 0.0f});
-    fill_buffer(s_data.quad_vertex_positions[2], {1.0f, 1.0f});
-    fill_buffer(s_data.quad_vertex_positions[3], {0.0f, 1.0f});
-
-    increment_quad_index();
-    ++s_data.stats.quad_count;
+    submitQuad(AxisAlignedQuad{position, size}, tint_color, quad_tex_coords, texture, tiling_factor);
 }
 
 void Renderer2D::drawQuad(const glm::vec2& position, const glm::vec2& size, const Ref<SubTexture2D>& subtexture,
@@ -260,48 +916,32 @@ void Renderer2D::drawQuad(const glm::vec3& position, const glm::vec2& size, cons
 {
     HZ_PROFILE_FUNCTION();
 
-    checkAndFlush();
+    submitQuad(AxisAlignedQuad{position, size}, tint_color, subtexture->getCoords(), subtexture->getTexture(),
+               tiling_factor);
+}
 
-    auto const& tex_coords{subtexture->getCoords()};
-    auto const& texture{subtexture->getTexture()};
+void Renderer2D::drawQuad(const glm::mat4& transform, const glm::vec4& color)
+{
+    HZ_PROFILE_FUNCTION();
 
-    auto const texture_index = [&texture]() noexcept {
-        for (std::uint32_t i{0}; i != s_data.texture_slot_index; ++i) {
-            if (*s_data.texture_slots[i] == *texture) {
-                return static_cast<float>(i);
-            }
-        }
-        return static_cast<float>(s_data.texture_slot_index);
-    }();
-    // If texture not found
-    if (static_cast<const std::uint32_t>(texture_index) == s_data.texture_slot_index) {
-        if (s_data.texture_slot_index >= Renderer2DData::max_texture_slots) {
-            checkAndFlush();
-        }
-        HZ_ASSERT(s_data.texture_slot_index != s_data.max_texture_slots, "Maximum texture slots exceeded");
-        s_data.texture_slots[static_cast<const std::uint32_t>(texture_index)] = texture;
-        ++s_data.texture_slot_index;
-    }
-
-    const glm::mat4 transform{glm::translate(glm::mat4(1.0f), position) *
-                              glm::scale(glm::mat4(1.0f), {size.x, size.y, 1.0f})};
-
-    auto const fill_buffer = [&transform, &tint_color, texture_index, tiling_factor](glm::vec4 const& pos,
-                                                                                     glm::vec2 tx_crd) noexcept {
-        s_data.quad_vertex_buffer_ptr->position = transform * pos;
-        s_data.quad_vertex_buffer_ptr->color = tint_color;
-        s_data.quad_vertex_buffer_ptr->tex_coord = tx_crd;
-        s_data.quad_vertex_buffer_ptr->tex_index = texture_index;
-        s_data.quad_vertex_buffer_ptr->tiling_factor = tiling_factor;
-        ++s_data.quad_vertex_buffer_ptr;
-    };
+    submitQuad(TransformedQuad{transform}, color, quad_tex_coords, s_data.white_texture, 1.0f);
+}
 
-    for (std::uint32_t i{0}; i != Renderer2DData::quad_vertex_count; ++i) {
-        fill_buffer(s_data.quad_vertex_positions[i], tex_coords[i]);
-    }
+void Renderer2D::drawQuad(const glm::mat4& transform, const Ref<Texture2D>& texture, float tiling_factor,
+                          const glm::vec4& tint_color)
+{
+    HZ_PROFILE_FUNCTION();
+
+    submitQuad(TransformedQuad{transform}, tint_color, quad_tex_coords, texture, tiling_factor);
+}
 
-    increment_quad_index();
-    ++s_data.stats.quad_count;
+void Renderer2D::drawQuad(const glm::mat4& transform, const Ref<SubTexture2D>& subtexture, float tiling_factor,
+                          const glm::vec4& tint_color)
+{
+    HZ_PROFILE_FUNCTION();
+
+    submitQuad(TransformedQuad{transform}, tint_color, subtexture->getCoords(), subtexture->getTexture(),
+               tiling_factor);
 }
 
 void Renderer2D::drawQuadRotated(const glm::vec2& position, const glm::vec2& size, float rotation,
@@ -315,28 +955,7 @@ void Renderer2D::drawQuadRotated(const glm::vec3& position, const glm::vec2& siz
 {
     HZ_PROFILE_FUNCTION();
 
-    checkAndFlush();
-
-    const glm::mat4 transform{glm::translate(glm::mat4(1.0f), position) *
-                              glm::rotate(glm::mat4(1.0f), rotation, {0.0f, 0.0f, 1.0f}) *
-                              glm::scale(glm::mat4(1.0f), {size.x, size.y, 1.0f})};
-
-    auto const fill_buffer = [&transform, &color](glm::vec4 const& pos, glm::vec2 tx_crd) noexcept {
-        constexpr float tiling_factor{1.0f};
-        s_data.quad_vertex_buffer_ptr->position = transform * pos;
-        s_data.quad_vertex_buffer_ptr->color = color;
-        s_data.quad_vertex_buffer_ptr->tex_coord = tx_crd;
-        s_data.quad_vertex_buffer_ptr->tex_index = s_data.white_texture_index;
-        s_data.quad_vertex_buffer_ptr->tiling_factor = tiling_factor;
-        ++s_data.quad_vertex_buffer_ptr;
-    };
-    fill_buffer(s_data.quad_vertex_positions[0], {0.0f, 0.0f});
-    fill_buffer(s_data.quad_vertex_positions[1], {1.0f, 0.0f});
-    fill_buffer(s_data.quad_vertex_positions[2], {1.0f, 1.0f});
-    fill_buffer(s_data.quad_vertex_positions[3], {0.0f, 1.0f});
-
-    increment_quad_index();
-    ++s_data.stats.quad_count;
+    submitQuad(RotatedQuad{position, size, rotation}, color, quad_tex_coords, s_data.white_texture, 1.0f);
 }
 
 void Renderer2D::drawQuadRotated(const glm::vec2& position, const glm::vec2& size, float rotation,
@@ -350,43 +969,7 @@ void Renderer2D::drawQuadRotated(const glm::vec3& position, const glm::vec2& siz
 {
     HZ_PROFILE_FUNCTION();
 
-    checkAndFlush();
-
-    auto const texture_index = [&texture]() noexcept {
-        for (std::uint32_t i{0}; i != s_data.texture_slot_index; ++i) {
-            if (*s_data.texture_slots[i] == *texture) {
-                return static_cast<float>(i);
-            }
-        }
-        return static_cast<float>(s_data.texture_slot_index);
-    }();
-    // If texture not found
-    if (static_cast<const std::uint32_t>(texture_index) == s_data.texture_slot_index) {
-        HZ_ASSERT(s_data.texture_slot_index != s_data.max_texture_slots, "Maximum texture slots exceeded");
-        s_data.texture_slots[static_cast<const std::uint32_t>(texture_index)] = texture;
-        ++s_data.texture_slot_index;
-    }
-
-    const glm::mat4 transform{glm::translate(glm::mat4(1.0f), position) *
-                              glm::rotate(glm::mat4(1.0f), rotation, {0.0f, 0.0f, 1.0f}) *
-                              glm::scale(glm::mat4(1.0f), {size.x, size.y, 1.0f})};
-
-    auto const fill_buffer = [&transform, &tint_color, texture_index, tiling_factor](glm::vec4 const& pos,
-                                                                                     glm::vec2 tx_crd) noexcept {
-        s_data.quad_vertex_buffer_ptr->position = transform * pos;
-        s_data.quad_vertex_buffer_ptr->color = tint_color;
-        s_data.quad_vertex_buffer_ptr->tex_coord = tx_crd;
-        s_data.quad_vertex_buffer_ptr->tex_index = texture_index;
-        s_data.quad_vertex_buffer_ptr->tiling_factor = tiling_factor;
-        ++s_data.quad_vertex_buffer_ptr;
-    };
-    fill_buffer(s_data.quad_vertex_positions[0], {0.0f, 0.0f});
-    fill_buffer(s_data.quad_vertex_positions[1], {1.0f, 0.0f});
-    fill_buffer(s_data.quad_vertex_positions[2], {1.0f, 1.0f});
-    fill_buffer(s_data.quad_vertex_positions[3], {0.0f, 1.0f});
-
-    increment_quad_index();
-    ++s_data.stats.quad_count;
+    submitQuad(RotatedQuad{position, size, rotation}, tint_color, quad_tex_coords, texture, tiling_factor);
 }
 
 void Renderer2D::drawQuadRotated(const glm::vec2& position, const glm::vec2& size, float rotation,
@@ -400,45 +983,139 @@ void Renderer2D::drawQuadRotated(const glm::vec3& position, const glm::vec2& siz
 {
     HZ_PROFILE_FUNCTION();
 
-    checkAndFlush();
+    submitQuad(RotatedQuad{position, size, rotation}, tint_color, subtexture->getCoords(), subtexture->getTexture(),
+               tiling_factor);
+}
 
-    auto const& tex_coords{subtexture->getCoords()};
-    auto const& texture{subtexture->getTexture()};
+void Renderer2D::drawQuads(const QuadInstance* quads, std::size_t count)
+{
+    drawQuads(quads, count, s_data.white_texture);
+}
 
-    auto const texture_index = [&texture]() noexcept {
-        for (std::uint32_t i{0}; i != s_data.texture_slot_index; ++i) {
-            if (*s_data.texture_slots[i] == *texture) {
-                return static_cast<float>(i);
+void Renderer2D::drawQuads(const QuadInstance* quads, std::size_t count, const Ref<Texture2D>& texture,
+                           float tiling_factor)
+{
+    HZ_PROFILE_FUNCTION();
+
+    if (s_data.culling) {
+        auto& visible{s_data.visible_instances};
+        visible.clear();
+        for (std::size_t i{0}; i != count; ++i) {
+            auto const& quad{quads[i]};
+            if (RotatedQuad{quad.position, quad.size, quad.rotation}.visible(s_data.cull_rect)) {
+                visible.push_back(quad);
             }
         }
-        return static_cast<float>(s_data.texture_slot_index);
-    }();
-    // If texture not found
-    if (static_cast<const std::uint32_t>(texture_index) == s_data.texture_slot_index) {
-        HZ_ASSERT(s_data.texture_slot_index != s_data.max_texture_slots, "Maximum texture slots exceeded");
-        s_data.texture_slots[static_cast<const std::uint32_t>(texture_index)] = texture;
-        ++s_data.texture_slot_index;
-    }
-
-    const glm::mat4 transform{glm::translate(glm::mat4(1.0f), position) *
-                              glm::rotate(glm::mat4(1.0f), rotation, {0.0f, 0.0f, 1.0f}) *
-                              glm::scale(glm::mat4(1.0f), {size.x, size.y, 1.0f})};
-
-    auto const fill_buffer = [&transform, &tint_color, texture_index, tiling_factor](glm::vec4 const& pos,
-                                                                                     glm::vec2 tx_crd) noexcept {
-        s_data.quad_vertex_buffer_ptr->position = transform * pos;
-        s_data.quad_vertex_buffer_ptr->color = tint_color;
-        s_data.quad_vertex_buffer_ptr->tex_coord = tx_crd;
-        s_data.quad_vertex_buffer_ptr->tex_index = texture_index;
-        s_data.quad_vertex_buffer_ptr->tiling_factor = tiling_factor;
-        ++s_data.quad_vertex_buffer_ptr;
-    };
-    for (std::uint32_t i{0}; i != Renderer2DData::quad_vertex_count; ++i) {
-        fill_buffer(s_data.quad_vertex_positions[i], tex_coords[i]);
+        s_data.stats.culled_quad_count += static_cast<std::uint32_t>(count - visible.size());
+        quads = visible.data();
+        count = visible.size();
+    }
+
+    if (s_data.submit_mode == SubmitMode::Deferred) {
+        for (std::size_t i{0}; i != count; ++i) {
+            auto const& quad{quads[i]};
+            defer_quad(RotatedQuad{quad.position, quad.size, quad.rotation}, quad.color,
+                       rect_tex_coords(quad.uv_min, quad.uv_max), texture, tiling_factor);
+        }
+        return;
+    }
+
+    while (count != 0) {
+        checkAndFlush();
+        auto const texture_index{getTextureIndex(texture)};
+
+        auto const batch_capacity{(Renderer2DData::max_indices - s_data.quad_index_count) / 6};
+        auto const batch_count{static_cast<std::uint32_t>(std::min<std::size_t>(count, batch_capacity))};
+        switch (s_data.quad_mode) {
+        case QuadMode::Batched:
+            s_data.quad_kernel.write(quads, batch_count, texture_index, tiling_factor, s_data.quad_vertex_buffer_ptr);
+            break;
+        case QuadMode::Instanced:
+            for (std::uint32_t i{0}; i != batch_count; ++i) {
+                auto const& quad{quads[i]};
+                write_instance(s_data.instance_buffer_ptr + i,
+                               RotatedQuad{quad.position, quad.size, quad.rotation}.axes(), quad.color,
+                               {quad.uv_min, quad.uv_max}, texture_index, tiling_factor);
+            }
+            break;
+        case QuadMode::Compact:
+            for (std::uint32_t i{0}; i != batch_count; ++i) {
+                auto const& quad{quads[i]};
+                write_compact_vertices(s_data.compact_vertex_buffer_ptr + i * Renderer2DData::quad_vertex_count,
+                                       RotatedQuad{quad.position, quad.size, quad.rotation}.corners(), quad.color,
+                                       rect_tex_coords(quad.uv_min, quad.uv_max), texture_index, tiling_factor);
+            }
+            break;
+        }
+
+        advance_quads(batch_count);
+        quads += batch_count;
+        count -= batch_count;
+    }
+}
+
+void Renderer2D::drawStaticBatch(const StaticBatch& batch, const glm::mat4& transform)
+{
+    HZ_PROFILE_FUNCTION();
+
+    if (!batch.isBuilt()) {
+        return;
+    }
+    if (s_data.culling) {
+        auto const& bounds{batch.getBounds()};
+        auto const center{transform * glm::vec4{(bounds.min + bounds.max) * 0.5f, 0.0f, 1.0f}};
+        auto const half_size{(bounds.max - bounds.min) * 0.5f};
+        if (!s_data.cull_rect.overlaps(glm::vec3{center}, glm::vec3{transform[0]} * half_size.x,
+                                       glm::vec3{transform[1]} * half_size.y)) {
+            s_data.stats.culled_quad_count += batch.getQuadCount();
+            return;
+        }
+    }
+
+    // Keeps the draw order - everything submitted so far goes first
+    submitDeferred();
+    if (s_data.quad_index_count != 0) {
+        nextBatch();
+    }
+
+    auto& shader{*s_data.texture_shader};
+    shader.bind();
+    shader.setUniform("u_view_projection", s_data.view_projection * transform);
+    auto const& vertex_array{batch.getVertexArray()};
+    vertex_array.bind();
+    for (auto const& segment : batch.getSegments()) {
+        // Every draw unbinds the textures afterwards, the white texture included
+        s_data.white_texture->bind(Renderer2DData::white_texture_index);
+        for (std::uint32_t i{0}; i != segment.textures.size(); ++i) {
+            segment.textures[i]->bind(Renderer2DData::first_texture_index + i);
+        }
+        RenderCommand::drawIndexed(vertex_array, segment.quad_count * 6,
+                                   segment.first_quad * Renderer2DData::quad_vertex_count);
+        ++s_data.stats.draw_calls;
+        s_data.stats.static_quad_count += segment.quad_count;
+    }
+    shader.setUniform("u_view_projection", s_data.view_projection);
+}
+
+void Renderer2D::drawInstanced(Shader& shader, const VertexArray& vertex_array, std::uint32_t instance_count)
+{
+    HZ_PROFILE_FUNCTION();
+
+    if (instance_count == 0) {
+        return;
+    }
+
+    // Keeps the draw order - everything submitted so far goes first
+    submitDeferred();
+    if (s_data.quad_index_count != 0) {
+        nextBatch();
     }
 
-    increment_quad_index();
-    ++s_data.stats.quad_count;
+    shader.bind();
+    shader.setUniform("u_view_projection", s_data.view_projection);
+    vertex_array.bind();
+    RenderCommand::drawIndexedInstanced(vertex_array, vertex_array.getIndexBuffer().getCount(), instance_count);
+    ++s_data.stats.draw_calls;
 }
 
 void Renderer2D::resetStats() noexcept { s_data.stats = Renderer2D::Statistics{}; }
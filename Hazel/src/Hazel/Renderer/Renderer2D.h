@@ -1,13 +1,44 @@
 #pragma once
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <optional>
+
 #include "Hazel/Renderer/OrthographicCamera.h"
+#include "Hazel/Renderer/Shader.h"
+#include "Hazel/Renderer/StaticBatch.h"
 #include "Hazel/Renderer/SubTexture2D.h"
 #include "Hazel/Renderer/Texture.h"
 
 namespace Hazel {
 
+// Per-quad input of the bulk Renderer2D::drawQuads API.
+// The quad is centered at `position`, scaled by `size` and rotated by `rotation` radians around the z axis.
+struct QuadInstance {
+    glm::vec3 position{0.0f};
+    float rotation{0.0f};
+    glm::vec2 size{1.0f};
+    glm::vec2 uv_min{0.0f};
+    glm::vec2 uv_max{1.0f};
+    glm::vec4 color{1.0f};
+};
+
 class Renderer2D {
 public:
+    enum class QuadMode {
+        Batched,    // every quad is expanded into 4 vertices on the CPU
+        Instanced,  // one record per quad is uploaded and expanded into the unit quad in the vertex shader
+        Compact,    // like Batched, with quantized vertices of about half the size - colors and texture coordinates
+                    // are clamped to [0, 1], tiling factors are rounded to multiples of 1/256
+    };
+
+    enum class SubmitMode {
+        Immediate,  // quads are batched in call order
+        Deferred,   // quads are collected and sorted at endScene - see setLayer
+    };
+
     static void init();
     static void shutdown();
 
@@ -15,6 +46,33 @@ public:
     static void endScene();
     static void flush();
 
+    // Selects how subsequently submitted quads are uploaded and drawn. May be called mid-scene -
+    // quads already submitted in the previous mode are flushed first.
+    static void setQuadMode(QuadMode mode);
+    static QuadMode getQuadMode() noexcept;
+
+    // Selects whether quads are drawn in call order or sorted. May be called mid-scene - quads collected in
+    // SubmitMode::Deferred so far are sorted and batched first.
+    static void setSubmitMode(SubmitMode mode);
+    static SubmitMode getSubmitMode() noexcept;
+
+    // Layer of the quads submitted from now on, only used in SubmitMode::Deferred. Layers are drawn in ascending
+    // order. Within a layer opaque quads (flat colors with alpha 1) come first, then textured and translucent ones
+    // back to front. Quads of the same kind and z are drawn in submission order. A translucent quad overlapping an
+    // opaque one at the same z is hidden by it, even if it was submitted first.
+    static void setLayer(std::uint8_t layer) noexcept;
+    static std::uint8_t getLayer() noexcept;
+
+    // Skips quads entirely outside the view of the camera passed to beginScene before they are batched - worthwhile
+    // when most of the submitted quads are off-screen. Rotated quads are tested by their bounding circle.
+    static void setCulling(bool enabled) noexcept;
+    static bool isCullingEnabled() noexcept;
+
+    // Number of worker threads expanding the quads collected in SubmitMode::Deferred into vertices, together with
+    // the thread calling endScene. 0 (the default) expands them on the calling thread only.
+    static void setWorkerThreadCount(std::uint32_t count);
+    static std::uint32_t getWorkerThreadCount() noexcept;
+
     // primitives
     static void drawQuad(const glm::vec2& position, const glm::vec2& size, const glm::vec4& color);
     static void drawQuad(const glm::vec3& position, const glm::vec2& size, const glm::vec4& color);
@@ -27,6 +85,13 @@ public:
     static void drawQuad(const glm::vec3& position, const glm::vec2& size, const Ref<SubTexture2D>& subtexture,
                          float tiling_factor = 1.0f, const glm::vec4& tint_color = glm::vec4(1.0f));
 
+    // Draws the unit quad (centered at the origin) transformed by a caller-supplied transform
+    static void drawQuad(const glm::mat4& transform, const glm::vec4& color);
+    static void drawQuad(const glm::mat4& transform, const Ref<Texture2D>& texture, float tiling_factor = 1.0f,
+                         const glm::vec4& tint_color = glm::vec4(1.0f));
+    static void drawQuad(const glm::mat4& transform, const Ref<SubTexture2D>& subtexture, float tiling_factor = 1.0f,
+                         const glm::vec4& tint_color = glm::vec4(1.0f));
+
     static void drawQuadRotated(const glm::vec2& position, const glm::vec2& size, float rotation,
                                 const glm::vec4& color);
     static void drawQuadRotated(const glm::vec3& position, const glm::vec2& size, float rotation,
@@ -44,9 +109,39 @@ public:
                                 const Ref<SubTexture2D>& subtexture, float tiling_factor = 1.0f,
                                 const glm::vec4& tint_color = glm::vec4(1.0f));
 
+    // Bulk submission of many quads sharing a single texture (or none, for flat-colored quads).
+    // In QuadMode::Batched vertices are generated by a SIMD kernel selected at init time based on the CPU's
+    // capabilities.
+    static void drawQuads(const QuadInstance* quads, std::size_t count);
+    static void drawQuads(const QuadInstance* quads, std::size_t count, const Ref<Texture2D>& texture,
+                          float tiling_factor = 1.0f);
+
+    // Draws a built StaticBatch, with `transform` applied on top of the quads' own positions. Whatever was submitted
+    // before is drawn first, so the batch ends up on top of it at equal depth.
+    static void drawStaticBatch(const StaticBatch& batch, const glm::mat4& transform = glm::mat4(1.0f));
+
+    // Draws `instance_count` instances of the indexed geometry of `vertex_array` with a caller-supplied shader, which
+    // gets the scene's "u_view_projection" uniform. Whatever was submitted before is drawn first.
+    static void drawInstanced(Shader& shader, const VertexArray& vertex_array, std::uint32_t instance_count);
+
+    template <typename Container>
+    static void drawQuads(const Container& quads)
+    {
+        drawQuads(std::data(quads), std::size(quads));
+    }
+
+    template <typename Container>
+    static void drawQuads(const Container& quads, const Ref<Texture2D>& texture, float tiling_factor = 1.0f)
+    {
+        drawQuads(std::data(quads), std::size(quads), texture, tiling_factor);
+    }
+
     struct Statistics {
         std::uint32_t draw_calls{};
         std::uint32_t quad_count{};
+        std::uint32_t texture_batch_breaks{};  // batches flushed early because every texture slot was taken
+        std::uint32_t culled_quad_count{};     // quads skipped by culling, not included in quad_count
+        std::uint32_t static_quad_count{};     // quads drawn from StaticBatches, not included in quad_count
 
         std::uint32_t getTotalVertexCount() const noexcept { return quad_count * 4; }
         std::uint32_t getTotalIndexCount() const noexcept { return quad_count * 6; }
@@ -57,7 +152,22 @@ public:
 
 private:
     static inline void resetDrawBuffers() noexcept;
+    // Uploads and draws the current batch
+    static inline void drawBatch();
+    // Draws everything submitted so far and starts a new, empty batch
+    static inline void nextBatch();
     static inline void checkAndFlush() noexcept;
+    // Slot of `texture` in the current batch - starts a new batch if the texture needs a slot and none is left
+    static inline float getTextureIndex(const Ref<Texture2D>& texture);
+    // Like getTextureIndex, but returns an empty optional instead of starting a new batch
+    static inline std::optional<float> findTextureIndex(const Ref<Texture2D>& texture) noexcept;
+
+    // Batches a quad, or collects it in SubmitMode::Deferred
+    template <typename Quad>
+    static inline void submitQuad(const Quad& quad, const glm::vec4& color, const std::array<glm::vec2, 4>& tex_coords,
+                                  const Ref<Texture2D>& texture, float tiling_factor);
+    // Sorts the quads collected in SubmitMode::Deferred and batches them
+    static void submitDeferred();
 };
 
 }  // namespace Hazel
@@ -1,7 +1,27 @@
 #include "RendererAPI.h"
 
+#include "Hazel/Core/AssertionHandler.h"
+#include "Platform/Null/NullRendererAPI.h"
+#include "Platform/OpenGL/OpenGLRendererAPI.h"
+
 namespace Hazel {
 
 RendererAPI::API RendererAPI::s_API{RendererAPI::API::OpenGL};
 
+Scope<RendererAPI> RendererAPI::create()
+{
+    switch (s_API) {
+    case RendererAPI::API::None:
+        HZ_EXPECTS(false, DefaultCoreHandler, Hazel::Enforce, "RendererAPI::API::None is currently not supported");
+    case RendererAPI::API::OpenGL:
+        return makeScope<OpenGLRendererAPI>();
+    case RendererAPI::API::Null:
+        return makeScope<NullRendererAPI>();
+    default:
+        HZ_EXPECTS(false, DefaultCoreHandler, Hazel::Enforce, "Unknown RendererAPI::API");
+    }
+
+    return nullptr;
+}
+
 }  // namespace Hazel
@@ -13,16 +13,36 @@ public:
     enum class API {
         None,
         OpenGL,
+        Null,   // headless, records submitted work in memory - see Platform/Null
     };
 
+    virtual ~RendererAPI() = default;
+
     virtual void init() = 0;
     virtual void setViewport(unsigned x, unsigned y, unsigned width, unsigned height) = 0;
     virtual void setClearColor(glm::vec4 const& color) = 0;
     virtual void clear() = 0;
 
-    virtual void drawIndexed(VertexArray const&, std::uint32_t index_count = 0) = 0;
+    // `base_vertex` is added to every index - used to draw from a region of a StreamingVertexBuffer
+    virtual void drawIndexed(VertexArray const&, std::uint32_t index_count = 0, std::uint32_t base_vertex = 0) = 0;
+    // Draws `instance_count` instances of the first `index_count` indices of the vertex array,
+    // fetching per-instance attributes starting from instance `base_instance`
+    virtual void drawIndexedInstanced(VertexArray const&, std::uint32_t index_count, std::uint32_t instance_count,
+                                      std::uint32_t base_instance = 0) = 0;
+
+    // Whether captureInstances is available - the Null backend doesn't run shaders
+    virtual bool supportsTransformFeedback() const noexcept = 0;
+    // Runs the vertex stage of the bound shader once for each of `instance_count` instances of a single point,
+    // fetching per-instance attributes from `vertex_array`. Nothing is rasterized - the outputs listed when the shader
+    // was created (see Shader::create) are written into `destination`, starting at byte `offset`.
+    virtual void captureInstances(VertexArray const& vertex_array, std::uint32_t instance_count,
+                                  VertexBuffer& destination, std::uint32_t offset = 0) = 0;
 
     static inline API getAPI() noexcept { return s_API; }
+    // Selects the backend used by subsequently created renderer resources. Call before Renderer::init.
+    static inline void setAPI(API api) noexcept { s_API = api; }
+
+    static Scope<RendererAPI> create();
 
 private:
     static API s_API;
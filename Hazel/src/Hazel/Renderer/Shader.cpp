@@ -3,6 +3,7 @@
 #include "Hazel/Core/AssertionHandler.h"
 #include "Hazel/Renderer/Renderer.h"
 
+#include "Platform/Null/NullShader.h"
 #include "Platform/OpenGL/OpenGLShader.h"
 
 namespace Hazel {
@@ -15,6 +16,25 @@ Scope<Shader> Shader::create(const std::string& filepath)
                   "RendererAPI::API::None is currently not supported");
     case RendererAPI::API::OpenGL:
         return std::make_unique<OpenGLShader>(filepath);
+    case RendererAPI::API::Null:
+        return std::make_unique<NullShader>(filepath);
+    default:
+        HZ_EXPECTS(false, DefaultCoreHandler, Hazel::Enforce, "Unknown RendererAPI::API");
+    }
+
+    return nullptr;
+}
+
+Scope<Shader> Shader::create(const std::string& filepath, const std::vector<std::string>& captured_outputs)
+{
+    switch (Renderer::getApi()) {
+    case RendererAPI::API::None:
+        HZ_EXPECTS(false, DefaultCoreHandler, Hazel::Enforce,
+                  "RendererAPI::API::None is currently not supported");
+    case RendererAPI::API::OpenGL:
+        return std::make_unique<OpenGLShader>(filepath, captured_outputs);
+    case RendererAPI::API::Null:
+        return std::make_unique<NullShader>(filepath);
     default:
         HZ_EXPECTS(false, DefaultCoreHandler, Hazel::Enforce, "Unknown RendererAPI::API");
     }
@@ -40,6 +60,8 @@ Scope<Shader> Shader::create(std::string const& name, const std::string& vertex_
                   "RendererAPI::API::None is currently not supported");
     case RendererAPI::API::OpenGL:
         return std::make_unique<OpenGLShader>(name, vertex_src, fragment_src);
+    case RendererAPI::API::Null:
+        return std::make_unique<NullShader>(name, vertex_src, fragment_src);
     default:
         HZ_EXPECTS(false, DefaultCoreHandler, Hazel::Enforce, "Unknown RendererAPI::API");
     }
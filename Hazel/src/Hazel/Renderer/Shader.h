@@ -1,6 +1,7 @@
 #pragma once
 
 #include <string>
+#include <vector>
 
 #include <glm/glm.hpp>
 
@@ -30,6 +31,9 @@ public:
     template<typename ShaderT>
     static Scope<ShaderT> create(const std::string& filepath);
     static Scope<Shader> create(const std::string& filepath);
+    // Shader for RenderCommand::captureInstances - the vertex stage outputs `captured_outputs` are written
+    // interleaved, in this order. The file may consist of a vertex stage only.
+    static Scope<Shader> create(const std::string& filepath, const std::vector<std::string>& captured_outputs);
 
     template <typename ShaderT>
     static Scope<ShaderT> create(const std::string& name, const std::string& vertex_src, const std::string& fragment_src);
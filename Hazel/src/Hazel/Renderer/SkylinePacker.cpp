@@ -0,0 +1,84 @@
+#include "SkylinePacker.h"
+
+#include <algorithm>
+
+namespace Hazel {
+
+SkylinePacker::SkylinePacker(std::uint32_t width, std::uint32_t height)
+    : width_{width}, height_{height}, skyline_{{0, 0, width}}
+{
+}
+
+std::optional<SkylinePacker::Position> SkylinePacker::insert(std::uint32_t width, std::uint32_t height)
+{
+    auto best{skyline_.size()};
+    auto best_top{height_ + 1};
+    auto best_node_width{width_ + 1};
+    for (std::size_t i{0}; i != skyline_.size(); ++i) {
+        auto const y{fit(i, width, height)};
+        if (!y) {
+            continue;
+        }
+        auto const top{*y + height};
+        if (top < best_top || (top == best_top && skyline_[i].width < best_node_width)) {
+            best = i;
+            best_top = top;
+            best_node_width = skyline_[i].width;
+        }
+    }
+    if (best == skyline_.size()) {
+        return std::nullopt;
+    }
+
+    Position const position{skyline_[best].x, best_top - height};
+    skyline_.insert(skyline_.begin() + static_cast<std::ptrdiff_t>(best), Node{position.x, best_top, width});
+
+    // the nodes under the new one are covered now - shrink or drop them
+    for (auto i{best + 1}; i != skyline_.size();) {
+        auto const covered_end{skyline_[i - 1].x + skyline_[i - 1].width};
+        auto& node{skyline_[i]};
+        if (node.x >= covered_end) {
+            break;
+        }
+        auto const overlap{covered_end - node.x};
+        if (node.width <= overlap) {
+            skyline_.erase(skyline_.begin() + static_cast<std::ptrdiff_t>(i));
+            continue;
+        }
+        node.x += overlap;
+        node.width -= overlap;
+        break;
+    }
+
+    for (std::size_t i{0}; i + 1 < skyline_.size();) {
+        if (skyline_[i].y == skyline_[i + 1].y) {
+            skyline_[i].width += skyline_[i + 1].width;
+            skyline_.erase(skyline_.begin() + static_cast<std::ptrdiff_t>(i + 1));
+        }
+        else {
+            ++i;
+        }
+    }
+
+    used_width_ = std::max(used_width_, position.x + width);
+    used_height_ = std::max(used_height_, best_top);
+    return position;
+}
+
+std::optional<std::uint32_t> SkylinePacker::fit(std::size_t i, std::uint32_t width, std::uint32_t height) const noexcept
+{
+    if (skyline_[i].x + width > width_) {
+        return std::nullopt;
+    }
+    std::uint32_t y{0};
+    for (auto remaining{width}; remaining != 0; ++i) {
+        y = std::max(y, skyline_[i].y);
+        if (y + height > height_) {
+            return std::nullopt;
+        }
+        remaining -= std::min(remaining, skyline_[i].width);
+    }
+    return y;
+}
+
+}  // namespace Hazel
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace Hazel {
+
+// Skyline bottom-left packer - the packed area is described by the top edge of everything placed so far, every new
+// rectangle goes wherever its top edge ends up lowest. Used by TextureAtlas to place images on its pages.
+class SkylinePacker {
+public:
+    struct Position {
+        std::uint32_t x;
+        std::uint32_t y;
+    };
+
+    SkylinePacker(std::uint32_t width, std::uint32_t height);
+
+    // Places a rectangle, nullopt if it doesn't fit anywhere - the packer is unchanged then
+    std::optional<Position> insert(std::uint32_t width, std::uint32_t height);
+
+    // Bounds of the rectangles placed so far
+    std::uint32_t getUsedWidth() const noexcept { return used_width_; }
+    std::uint32_t getUsedHeight() const noexcept { return used_height_; }
+
+private:
+    struct Node {
+        std::uint32_t x;
+        std::uint32_t y;
+        std::uint32_t width;
+    };
+
+    // Height at which a rectangle with its left edge at node `i` would rest, nullopt if it doesn't fit there
+    std::optional<std::uint32_t> fit(std::size_t i, std::uint32_t width, std::uint32_t height) const noexcept;
+
+    std::uint32_t width_;
+    std::uint32_t height_;
+    std::uint32_t used_width_{0};
+    std::uint32_t used_height_{0};
+    std::vector<Node> skyline_;
+};
+
+}  // namespace Hazel
@@ -0,0 +1,149 @@
+#include "StaticBatch.h"
+
+#include <algorithm>
+#include <iterator>
+
+#include "Hazel/Renderer/QuadKernels.h"
+
+namespace Hazel {
+
+namespace {
+constexpr const std::uint32_t quad_vertex_count{4};
+const std::array<glm::vec2, quad_vertex_count> quad_tex_coords{
+    {{0.0f, 0.0f}, {1.0f, 0.0f}, {1.0f, 1.0f}, {0.0f, 1.0f}}};
+}  // namespace
+
+void StaticBatch::addQuad(const glm::vec3& position, const glm::vec2& size, const glm::vec4& color)
+{
+    record(position, {size.x * 0.5f, 0.0f, 0.0f}, {0.0f, size.y * 0.5f, 0.0f}, color, quad_tex_coords, nullptr, 1.0f);
+}
+
+void StaticBatch::addQuad(const glm::vec3& position, const glm::vec2& size, const Ref<Texture2D>& texture,
+                          float tiling_factor, const glm::vec4& tint_color)
+{
+    record(position, {size.x * 0.5f, 0.0f, 0.0f}, {0.0f, size.y * 0.5f, 0.0f}, tint_color, quad_tex_coords, texture,
+           tiling_factor);
+}
+
+void StaticBatch::addQuad(const glm::vec3& position, const glm::vec2& size, const Ref<SubTexture2D>& subtexture,
+                          float tiling_factor, const glm::vec4& tint_color)
+{
+    record(position, {size.x * 0.5f, 0.0f, 0.0f}, {0.0f, size.y * 0.5f, 0.0f}, tint_color, subtexture->getCoords(),
+           subtexture->getTexture(), tiling_factor);
+}
+
+void StaticBatch::addQuad(const glm::mat4& transform, const glm::vec4& color)
+{
+    record(glm::vec3{transform[3]}, glm::vec3{transform[0]} * 0.5f, glm::vec3{transform[1]} * 0.5f, color,
+           quad_tex_coords, nullptr, 1.0f);
+}
+
+void StaticBatch::addQuad(const glm::mat4& transform, const Ref<Texture2D>& texture, float tiling_factor,
+                          const glm::vec4& tint_color)
+{
+    record(glm::vec3{transform[3]}, glm::vec3{transform[0]} * 0.5f, glm::vec3{transform[1]} * 0.5f, tint_color,
+           quad_tex_coords, texture, tiling_factor);
+}
+
+void StaticBatch::addQuad(const glm::mat4& transform, const Ref<SubTexture2D>& subtexture, float tiling_factor,
+                          const glm::vec4& tint_color)
+{
+    record(glm::vec3{transform[3]}, glm::vec3{transform[0]} * 0.5f, glm::vec3{transform[1]} * 0.5f, tint_color,
+           subtexture->getCoords(), subtexture->getTexture(), tiling_factor);
+}
+
+void StaticBatch::record(const glm::vec3& center, const glm::vec3& x_axis, const glm::vec3& y_axis,
+                         const glm::vec4& color, const std::array<glm::vec2, 4>& tex_coords,
+                         const Ref<Texture2D>& texture, float tiling_factor)
+{
+    records_.push_back({center, x_axis, y_axis, color, tex_coords, texture, tiling_factor});
+}
+
+void StaticBatch::build()
+{
+    HZ_PROFILE_FUNCTION();
+
+    // The uploaded quads can't be rebuilt from system memory - keep them rather than leave an empty batch
+    if (records_.empty()) {
+        return;
+    }
+    segments_.clear();
+
+    std::vector<QuadVertex> vertices;
+    vertices.reserve(records_.size() * quad_vertex_count);
+    bounds_ = Bounds{glm::vec2{records_.front().center}, glm::vec2{records_.front().center}};
+
+    Segment* segment{nullptr};
+    for (auto const& quad : records_) {
+        auto const quad_index{static_cast<std::uint32_t>(vertices.size() / quad_vertex_count)};
+
+        float texture_index{0.0f};
+        if (segment == nullptr || segment->quad_count == max_segment_quads) {
+            segment = &segments_.emplace_back(Segment{quad_index, 0, {}});
+        }
+        if (quad.texture) {
+            auto const& textures{segment->textures};
+            auto it{std::find(textures.cbegin(), textures.cend(), quad.texture)};
+            if (it == textures.cend()) {
+                if (textures.size() == max_segment_textures) {
+                    segment = &segments_.emplace_back(Segment{quad_index, 0, {}});
+                }
+                segment->textures.push_back(quad.texture);
+                it = std::prev(segment->textures.cend());
+            }
+            texture_index = static_cast<float>(1 + (it - segment->textures.cbegin()));
+        }
+        ++segment->quad_count;
+
+        std::array<glm::vec3, quad_vertex_count> const corners{
+            {quad.center - quad.x_axis - quad.y_axis, quad.center + quad.x_axis - quad.y_axis,
+             quad.center + quad.x_axis + quad.y_axis, quad.center - quad.x_axis + quad.y_axis}};
+        for (std::uint32_t i{0}; i != quad_vertex_count; ++i) {
+            vertices.push_back({corners[i], quad.color, quad.tex_coords[i], texture_index, quad.tiling_factor});
+            bounds_.min = glm::min(bounds_.min, glm::vec2{corners[i]});
+            bounds_.max = glm::max(bounds_.max, glm::vec2{corners[i]});
+        }
+    }
+    built_quad_count_ = static_cast<std::uint32_t>(records_.size());
+    records_.clear();
+    records_.shrink_to_fit();
+
+    // QuadVertex consists of floats only
+    auto vertex_buffer{VertexBuffer::create(reinterpret_cast<const float*>(vertices.data()),
+                                            static_cast<std::uint32_t>(vertices.size() * sizeof(QuadVertex)))};
+    vertex_buffer->setLayout({{ShaderDataType::Float3, "a_position"},
+                              {ShaderDataType::Float4, "a_color"},
+                              {ShaderDataType::Float2, "a_tex_coord"},
+                              {ShaderDataType::Float, "a_tex_index"},
+                              {ShaderDataType::Float, "a_tiling_factor"}});
+
+    // Every segment is drawn with the same indices, offset by its first vertex
+    auto const max_quads{std::max_element(segments_.cbegin(), segments_.cend(), [](auto const& l, auto const& r) {
+                             return l.quad_count < r.quad_count;
+                         })->quad_count};
+    std::vector<std::uint32_t> indices(max_quads * 6);
+    for (std::uint32_t quad{0}, offset{0}; quad != max_quads; ++quad, offset += quad_vertex_count) {
+        auto* index{&indices[quad * 6]};
+        index[0] = offset + 0;
+        index[1] = offset + 1;
+        index[2] = offset + 2;
+        index[3] = offset + 2;
+        index[4] = offset + 3;
+        index[5] = offset + 0;
+    }
+
+    vertex_array_ = VertexArray::create();
+    vertex_array_->addVertexBuffer(std::move(vertex_buffer));
+    vertex_array_->setIndexBuffer(IndexBuffer::create(indices));
+}
+
+void StaticBatch::clear()
+{
+    records_.clear();
+    segments_.clear();
+    vertex_array_.reset();
+    bounds_ = Bounds{};
+    built_quad_count_ = 0;
+}
+
+}  // namespace Hazel
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "Hazel/Core/Base.h"
+#include "Hazel/Renderer/SubTexture2D.h"
+#include "Hazel/Renderer/Texture.h"
+#include "Hazel/Renderer/VertexArray.h"
+
+namespace Hazel
+{
+// Quads that are uploaded to the GPU once and then drawn every frame without being regenerated - tilemaps,
+// backgrounds and other geometry that doesn't change between frames.
+//
+// Usage: addQuad() every quad, build() once, then Renderer2D::drawStaticBatch() between beginScene and endScene.
+// The quads are drawn in the order they were added. The quads are only kept on the GPU - quads added after build()
+// replace the batch on the next build(), while a build() without new quads keeps the uploaded batch.
+class StaticBatch {
+public:
+    // Quads drawn with a single draw call - a new segment starts whenever the texture slots or the index buffer
+    // run out
+    struct Segment {
+        std::uint32_t first_quad;
+        std::uint32_t quad_count;
+        std::vector<Ref<Texture2D>> textures;  // bound from slot 1 on, slot 0 is Renderer2D's white texture
+    };
+
+    // Axis-aligned box of all quads, before the transform passed to Renderer2D::drawStaticBatch
+    struct Bounds {
+        glm::vec2 min{0.0f};
+        glm::vec2 max{0.0f};
+    };
+
+    static constexpr const std::uint32_t max_segment_quads{10'000};
+    static constexpr const std::uint32_t max_segment_textures{31};
+
+    void addQuad(const glm::vec3& position, const glm::vec2& size, const glm::vec4& color);
+    void addQuad(const glm::vec3& position, const glm::vec2& size, const Ref<Texture2D>& texture,
+                 float tiling_factor = 1.0f, const glm::vec4& tint_color = glm::vec4(1.0f));
+    void addQuad(const glm::vec3& position, const glm::vec2& size, const Ref<SubTexture2D>& subtexture,
+                 float tiling_factor = 1.0f, const glm::vec4& tint_color = glm::vec4(1.0f));
+    // The unit quad (centered at the origin) transformed by `transform`
+    void addQuad(const glm::mat4& transform, const glm::vec4& color);
+    void addQuad(const glm::mat4& transform, const Ref<Texture2D>& texture, float tiling_factor = 1.0f,
+                 const glm::vec4& tint_color = glm::vec4(1.0f));
+    void addQuad(const glm::mat4& transform, const Ref<SubTexture2D>& subtexture, float tiling_factor = 1.0f,
+                 const glm::vec4& tint_color = glm::vec4(1.0f));
+
+    // Uploads every quad added since the previous build and releases them from system memory, replacing the uploaded
+    // batch. Does nothing if no quad was added since - use clear() to remove the uploaded quads.
+    void build();
+    // Removes all quads, including the uploaded ones
+    void clear();
+
+    bool isBuilt() const noexcept { return vertex_array_ != nullptr; }
+    // Quads in the uploaded batch - 0 until built
+    std::uint32_t getQuadCount() const noexcept { return built_quad_count_; }
+    const VertexArray& getVertexArray() const noexcept { return *vertex_array_; }
+    const std::vector<Segment>& getSegments() const noexcept { return segments_; }
+    const Bounds& getBounds() const noexcept { return bounds_; }
+
+private:
+    struct Record {
+        glm::vec3 center;
+        glm::vec3 x_axis;  // half-extent axes
+        glm::vec3 y_axis;
+        glm::vec4 color;
+        std::array<glm::vec2, 4> tex_coords;
+        Ref<Texture2D> texture;  // empty for flat-colored quads
+        float tiling_factor;
+    };
+
+    void record(const glm::vec3& center, const glm::vec3& x_axis, const glm::vec3& y_axis, const glm::vec4& color,
+                const std::array<glm::vec2, 4>& tex_coords, const Ref<Texture2D>& texture, float tiling_factor);
+
+    std::vector<Record> records_;
+    Scope<VertexArray> vertex_array_;
+    std::vector<Segment> segments_;
+    Bounds bounds_;
+    std::uint32_t built_quad_count_{0};
+};
+}  // namespace Hazel
@@ -2,6 +2,7 @@
 
 #include "Hazel/Core/AssertionHandler.h"
 #include "Hazel/Renderer/Renderer.h"
+#include "Platform/Null/NullTexture.h"
 #include "Platform/OpenGL/OpenGLTexture.h"
 
 namespace Hazel {
@@ -13,6 +14,8 @@ Ref<Texture2D> Texture2D::create(const std::string& path)
         HZ_EXPECTS(false, DefaultCoreHandler, Hazel::Enforce, "RendererAPI::API::None is currently not supported");
     case RendererAPI::API::OpenGL:
         return makeRef<OpenGLTexture2D>(path);
+    case RendererAPI::API::Null:
+        return makeRef<NullTexture2D>(path);
     default:
         HZ_EXPECTS(false, DefaultCoreHandler, Hazel::Enforce, "Unknown RendererAPI::API");
     }
@@ -43,6 +46,8 @@ Ref<Texture2D> Texture2D::create(unsigned width, unsigned height)
         HZ_EXPECTS(false, DefaultCoreHandler, Hazel::Enforce, "RendererAPI::API::None is currently not supported");
     case RendererAPI::API::OpenGL:
         return create<OpenGLTexture2D>(width, height);
+    case RendererAPI::API::Null:
+        return makeRef<NullTexture2D>(width, height);
     default:
         HZ_EXPECTS(false, DefaultCoreHandler, Hazel::Enforce, "Unknown RendererAPI::API");
     }
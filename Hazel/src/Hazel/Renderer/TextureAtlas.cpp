@@ -0,0 +1,160 @@
+#include "TextureAtlas.h"
+
+#include <stb/stb_image.h>
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+#include <optional>
+
+#include "Hazel/Core/AssertionHandler.h"
+#include "Hazel/Renderer/SkylinePacker.h"
+
+namespace Hazel {
+
+namespace {
+constexpr const std::uint32_t bytes_per_pixel{4};
+
+inline std::uint32_t next_power_of_two(std::uint32_t value) noexcept
+{
+    std::uint32_t result{1};
+    while (result < value) {
+        result <<= 1;
+    }
+    return result;
+}
+}  // namespace
+
+TextureAtlas::TextureAtlas(TextureAtlasSpecification const& spec) : spec_{spec}
+{
+    HZ_EXPECTS(spec_.page_width > 2 * spec_.padding && spec_.page_height > 2 * spec_.padding, DefaultCoreHandler,
+               Hazel::Enforce, "TextureAtlas pages too small for the padding");
+}
+
+TextureAtlas::Handle TextureAtlas::add(std::string const& path)
+{
+    HZ_PROFILE_FUNCTION();
+
+    if (auto const it{handles_by_path_.find(path)}; it != handles_by_path_.end()) {
+        return it->second;
+    }
+
+    int width, height, channels;
+    stbi_set_flip_vertically_on_load(true);
+    stbi_uc* data{stbi_load(path.c_str(), &width, &height, &channels, bytes_per_pixel)};
+    HZ_EXPECTS(data != nullptr, DefaultCoreHandler, Hazel::Enforce, "Failed to load image");
+    auto const handle{add(width, height, data)};
+    stbi_image_free(data);
+
+    handles_by_path_.emplace(path, handle);
+    return handle;
+}
+
+TextureAtlas::Handle TextureAtlas::add(std::uint32_t width, std::uint32_t height, void const* pixels)
+{
+    HZ_EXPECTS(width != 0 && height != 0, DefaultCoreHandler, Hazel::Enforce, "Empty image added to TextureAtlas");
+    HZ_EXPECTS(width + 2 * spec_.padding <= spec_.page_width && height + 2 * spec_.padding <= spec_.page_height,
+               DefaultCoreHandler, Hazel::Enforce, "Image doesn't fit into a TextureAtlas page");
+
+    auto const* bytes{static_cast<std::uint8_t const*>(pixels)};
+    entries_.push_back(Entry{width, height,
+                             std::vector<std::uint8_t>(bytes, bytes + std::size_t{width} * height * bytes_per_pixel),
+                             nullptr});
+    return static_cast<Handle>(entries_.size() - 1);
+}
+
+void TextureAtlas::build()
+{
+    HZ_PROFILE_FUNCTION();
+
+    if (first_unpacked_ == entries_.size()) {
+        return;
+    }
+
+    // Tallest first - keeps the skyline flat
+    std::vector<Handle> order(entries_.size() - first_unpacked_);
+    std::iota(order.begin(), order.end(), first_unpacked_);
+    std::stable_sort(order.begin(), order.end(), [this](Handle l, Handle r) {
+        auto const& lhs{entries_[l]};
+        auto const& rhs{entries_[r]};
+        return lhs.height != rhs.height ? lhs.height > rhs.height : lhs.width > rhs.width;
+    });
+
+    struct Placement {
+        std::size_t page;
+        SkylinePacker::Position position;
+    };
+    std::vector<SkylinePacker> packers;
+    std::vector<Placement> placements(entries_.size() - first_unpacked_);
+    for (auto const handle : order) {
+        auto const& entry{entries_[handle]};
+        auto const width{entry.width + 2 * spec_.padding};
+        auto const height{entry.height + 2 * spec_.padding};
+
+        std::optional<SkylinePacker::Position> position;
+        auto page{std::size_t{0}};
+        for (; page != packers.size() && !position; ++page) {
+            position = packers[page].insert(width, height);
+        }
+        if (!position) {
+            position = packers.emplace_back(spec_.page_width, spec_.page_height).insert(width, height);
+            page = packers.size();
+        }
+        placements[handle - first_unpacked_] = Placement{page - 1, *position};
+    }
+
+    // Pages are cut down to the smallest power of two that covers their content
+    std::vector<std::vector<std::uint8_t>> page_pixels;
+    std::vector<Ref<Texture2D>> new_pages;
+    for (auto const& packer : packers) {
+        auto const width{std::min(spec_.page_width, next_power_of_two(packer.getUsedWidth()))};
+        auto const height{std::min(spec_.page_height, next_power_of_two(packer.getUsedHeight()))};
+        page_pixels.emplace_back(std::size_t{width} * height * bytes_per_pixel);
+        new_pages.push_back(Texture2D::create(width, height));
+    }
+
+    auto const padding{spec_.padding};
+    for (auto handle{first_unpacked_}; handle != entries_.size(); ++handle) {
+        auto& entry{entries_[handle]};
+        auto const& [page, position]{placements[handle - first_unpacked_]};
+        auto const& texture{new_pages[page]};
+        auto const page_width{texture->getWidth()};
+        auto* const page_data{page_pixels[page].data()};
+
+        auto const row_bytes{std::size_t{entry.width} * bytes_per_pixel};
+        for (std::uint32_t row{0}; row != entry.height + 2 * padding; ++row) {
+            // rows and columns in the padding repeat the nearest edge pixel
+            auto const source_row{std::min(row > padding ? row - padding : 0u, entry.height - 1)};
+            auto const* source{entry.pixels.data() + source_row * row_bytes};
+            auto* destination{page_data +
+                              (std::size_t{position.y + row} * page_width + position.x) * bytes_per_pixel};
+            for (std::uint32_t column{0}; column != padding; ++column) {
+                std::memcpy(destination + column * bytes_per_pixel, source, bytes_per_pixel);
+                std::memcpy(destination + (padding + entry.width + column) * bytes_per_pixel,
+                            source + row_bytes - bytes_per_pixel, bytes_per_pixel);
+            }
+            std::memcpy(destination + padding * bytes_per_pixel, source, row_bytes);
+        }
+
+        glm::vec2 const page_size{static_cast<float>(page_width), static_cast<float>(texture->getHeight())};
+        glm::vec2 const min{static_cast<float>(position.x + padding), static_cast<float>(position.y + padding)};
+        glm::vec2 const max{min + glm::vec2{static_cast<float>(entry.width), static_cast<float>(entry.height)}};
+        entry.subtexture = makeRef<SubTexture2D>(texture, min / page_size, max / page_size);
+        entry.pixels = std::vector<std::uint8_t>{};
+    }
+
+    for (std::size_t page{0}; page != new_pages.size(); ++page) {
+        new_pages[page]->setData(page_pixels[page].data(), static_cast<unsigned>(page_pixels[page].size()));
+        pages_.push_back(std::move(new_pages[page]));
+    }
+    first_unpacked_ = static_cast<Handle>(entries_.size());
+}
+
+Ref<SubTexture2D> const& TextureAtlas::getSubTexture(Handle handle) const
+{
+    HZ_EXPECTS(handle < first_unpacked_, DefaultCoreHandler, Hazel::Enforce,
+               "TextureAtlas image requested before it was packed");
+    return entries_[handle].subtexture;
+}
+
+}  // namespace Hazel
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Hazel/Core/Base.h"
+#include "Hazel/Renderer/SubTexture2D.h"
+#include "Hazel/Renderer/Texture.h"
+
+namespace Hazel
+{
+struct TextureAtlasSpecification
+{
+    std::uint32_t page_width{2048};
+    std::uint32_t page_height{2048};
+    // Border around every image, filled by extruding the image's edge pixels - keeps linear filtering from
+    // picking up the neighbouring images
+    std::uint32_t padding{1};
+};
+
+// Packs individually loaded images into a few large Texture2D pages (skyline bottom-left bin packing), so that
+// Renderer2D can draw all of them without running out of texture slots.
+//
+// Usage: add() every image, build() once, then draw with the SubTexture2Ds from getSubTexture().
+// Images are kept in system memory only until they are packed. Atlas pages don't wrap - tiling factors other than
+// 1 sample the neighbouring images.
+class TextureAtlas {
+public:
+    using Handle = std::uint32_t;
+
+    explicit TextureAtlas(TextureAtlasSpecification const& spec = {});
+
+    // Loading the same path twice returns the same handle
+    Handle add(std::string const& path);
+    // `pixels` are tightly packed RGBA8 rows, bottom row first (same as the loaded images)
+    Handle add(std::uint32_t width, std::uint32_t height, void const* pixels);
+
+    // Packs every image added since the previous build into new pages and uploads them
+    void build();
+
+    // Only valid once the image has been packed by build()
+    Ref<SubTexture2D> const& getSubTexture(Handle handle) const;
+
+    std::vector<Ref<Texture2D>> const& getPages() const noexcept { return pages_; }
+    std::size_t size() const noexcept { return entries_.size(); }
+    TextureAtlasSpecification const& getSpecification() const noexcept { return spec_; }
+
+private:
+    struct Entry {
+        std::uint32_t width;
+        std::uint32_t height;
+        std::vector<std::uint8_t> pixels;  // RGBA8, released once packed
+        Ref<SubTexture2D> subtexture;
+    };
+
+    TextureAtlasSpecification spec_;
+    std::vector<Entry> entries_;
+    std::vector<Ref<Texture2D>> pages_;
+    std::unordered_map<std::string, Handle> handles_by_path_;
+    Handle first_unpacked_{0};
+};
+} // namespace Hazel
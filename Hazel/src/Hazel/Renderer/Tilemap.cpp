@@ -0,0 +1,176 @@
+#include "Tilemap.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+
+#include "Hazel/Core/AssertionHandler.h"
+#include "Hazel/Renderer/Renderer2D.h"
+
+namespace Hazel {
+
+namespace {
+struct WorldRect {
+    glm::vec2 min;
+    glm::vec2 max;
+};
+
+// World-space bounding box of everything `view_projection` maps into the clip-space square [-1, 1] x [-1, 1].
+// Orthographic cameras map xy affinely, so only the 2x2 linear part and the translation are needed.
+WorldRect visible_rect(glm::mat4 const& view_projection) noexcept
+{
+    auto const a{view_projection[0][0]};
+    auto const b{view_projection[1][0]};
+    auto const c{view_projection[0][1]};
+    auto const d{view_projection[1][1]};
+    auto const det{a * d - b * c};
+    if (det == 0.0f) {
+        return {glm::vec2{0.0f}, glm::vec2{0.0f}};
+    }
+
+    // inverse of {{a, b}, {c, d}} applied to the clip-space center and half-extents
+    auto const offset_x{-view_projection[3][0]};
+    auto const offset_y{-view_projection[3][1]};
+    glm::vec2 const center{(d * offset_x - b * offset_y) / det, (a * offset_y - c * offset_x) / det};
+    glm::vec2 const extent{(std::abs(d) + std::abs(b)) / std::abs(det), (std::abs(c) + std::abs(a)) / std::abs(det)};
+    return {center - extent, center + extent};
+}
+
+// Range of chunks [first, last] covering the world coordinates [min, max] along one axis
+std::pair<std::uint32_t, std::uint32_t> chunk_range(float min, float max, float origin, float chunk_extent,
+                                                    std::uint32_t chunk_count) noexcept
+{
+    auto const first{std::floor((min - origin) / chunk_extent)};
+    auto const last{std::floor((max - origin) / chunk_extent)};
+    if (last < 0.0f || first >= static_cast<float>(chunk_count)) {
+        return {1, 0};
+    }
+    return {static_cast<std::uint32_t>(std::max(first, 0.0f)),
+            static_cast<std::uint32_t>(std::min(last, static_cast<float>(chunk_count - 1)))};
+}
+}  // namespace
+
+Tilemap::Tilemap(TilemapSpecification const& spec)
+    : spec_{spec}, chunks_x_{(spec.width + spec.chunk_size - 1) / std::max(spec.chunk_size, 1u)},
+      chunks_y_{(spec.height + spec.chunk_size - 1) / std::max(spec.chunk_size, 1u)},
+      tiles_(static_cast<std::size_t>(spec.width) * spec.height, empty_tile),
+      chunks_(static_cast<std::size_t>(chunks_x_) * chunks_y_)
+{
+    HZ_EXPECTS(spec.chunk_size != 0, DefaultCoreHandler, Hazel::Enforce, "Tilemap chunks must not be empty");
+    // One chunk has to fit into a single StaticBatch segment
+    HZ_EXPECTS(spec.chunk_size * spec.chunk_size <= StaticBatch::max_segment_quads, DefaultCoreHandler,
+               Hazel::Enforce, "Tilemap chunk size too large");
+}
+
+Tilemap::Tile Tilemap::addTileType(Ref<SubTexture2D> const& subtexture, glm::vec4 const& tint_color)
+{
+    HZ_EXPECTS(tile_types_.size() < std::numeric_limits<Tile>::max(), DefaultCoreHandler, Hazel::Enforce,
+               "Too many Tilemap tile types");
+    tile_types_.push_back({subtexture, tint_color});
+    return static_cast<Tile>(tile_types_.size());
+}
+
+void Tilemap::setTile(std::uint32_t x, std::uint32_t y, Tile tile)
+{
+    HZ_EXPECTS(x < spec_.width && y < spec_.height, DefaultCoreHandler, Hazel::Enforce, "Tile outside the Tilemap");
+    HZ_EXPECTS(tile <= tile_types_.size(), DefaultCoreHandler, Hazel::Enforce, "Unknown Tilemap tile type");
+    auto& current{tiles_[static_cast<std::size_t>(y) * spec_.width + x]};
+    if (current != tile) {
+        current = tile;
+        chunks_[(y / spec_.chunk_size) * chunks_x_ + x / spec_.chunk_size].dirty = true;
+    }
+}
+
+Tilemap::Tile Tilemap::getTile(std::uint32_t x, std::uint32_t y) const
+{
+    HZ_EXPECTS(x < spec_.width && y < spec_.height, DefaultCoreHandler, Hazel::Enforce, "Tile outside the Tilemap");
+    return tiles_[static_cast<std::size_t>(y) * spec_.width + x];
+}
+
+void Tilemap::draw(OrthographicCamera const& camera)
+{
+    HZ_PROFILE_FUNCTION();
+
+    ++frame_;
+    stats_.drawn_chunks = 0;
+    stats_.baked_chunks = 0;
+
+    auto const view{visible_rect(camera.getViewProjection())};
+    auto const chunk_extent{spec_.tile_size * static_cast<float>(spec_.chunk_size)};
+    auto const [first_x, last_x]{chunk_range(view.min.x, view.max.x, spec_.origin.x, chunk_extent.x, chunks_x_)};
+    auto const [first_y, last_y]{chunk_range(view.min.y, view.max.y, spec_.origin.y, chunk_extent.y, chunks_y_)};
+
+    for (auto chunk_y{first_y}; chunk_y <= last_y && chunk_y < chunks_y_; ++chunk_y) {
+        for (auto chunk_x{first_x}; chunk_x <= last_x && chunk_x < chunks_x_; ++chunk_x) {
+            auto& chunk{chunks_[chunk_y * chunks_x_ + chunk_x]};
+            if (chunk.dirty) {
+                bake(chunk_x, chunk_y);
+            }
+            chunk.last_drawn_frame = frame_;
+            if (chunk.batch.getQuadCount() != 0) {
+                Renderer2D::drawStaticBatch(chunk.batch);
+                ++stats_.drawn_chunks;
+            }
+        }
+    }
+
+    evictChunks();
+    stats_.resident_chunks = static_cast<std::uint32_t>(resident_chunks_.size());
+}
+
+void Tilemap::bake(std::uint32_t chunk_x, std::uint32_t chunk_y)
+{
+    auto const chunk_index{chunk_y * chunks_x_ + chunk_x};
+    auto& chunk{chunks_[chunk_index]};
+    auto& batch{chunk.batch};
+
+    auto const first_x{chunk_x * spec_.chunk_size};
+    auto const first_y{chunk_y * spec_.chunk_size};
+    auto const end_x{std::min(first_x + spec_.chunk_size, spec_.width)};
+    auto const end_y{std::min(first_y + spec_.chunk_size, spec_.height)};
+    for (auto y{first_y}; y != end_y; ++y) {
+        for (auto x{first_x}; x != end_x; ++x) {
+            auto const tile{tiles_[static_cast<std::size_t>(y) * spec_.width + x]};
+            if (tile == empty_tile) {
+                continue;
+            }
+            auto const& type{tile_types_[tile - 1]};
+            glm::vec3 const center{spec_.origin.x + (static_cast<float>(x) + 0.5f) * spec_.tile_size.x,
+                                   spec_.origin.y + (static_cast<float>(y) + 0.5f) * spec_.tile_size.y,
+                                   spec_.origin.z};
+            batch.addQuad(center, spec_.tile_size, type.subtexture, 1.0f, type.tint_color);
+        }
+    }
+    batch.build();
+    chunk.dirty = false;
+    ++stats_.baked_chunks;
+
+    if (!chunk.resident) {
+        chunk.resident = true;
+        resident_chunks_.push_back(chunk_index);
+    }
+}
+
+void Tilemap::evictChunks()
+{
+    if (resident_chunks_.size() <= spec_.max_resident_chunks) {
+        return;
+    }
+
+    // Least recently drawn first - chunks visible in this frame are never released
+    std::sort(resident_chunks_.begin(), resident_chunks_.end(), [this](std::uint32_t l, std::uint32_t r) {
+        return chunks_[l].last_drawn_frame < chunks_[r].last_drawn_frame;
+    });
+    auto const excess{resident_chunks_.size() - spec_.max_resident_chunks};
+    std::size_t evicted{0};
+    for (; evicted != excess && chunks_[resident_chunks_[evicted]].last_drawn_frame != frame_; ++evicted) {
+        auto& chunk{chunks_[resident_chunks_[evicted]]};
+        chunk.batch.clear();
+        chunk.dirty = true;
+        chunk.resident = false;
+    }
+    resident_chunks_.erase(resident_chunks_.begin(), resident_chunks_.begin() + evicted);
+}
+
+}  // namespace Hazel
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "Hazel/Core/Base.h"
+#include "Hazel/Renderer/OrthographicCamera.h"
+#include "Hazel/Renderer/StaticBatch.h"
+#include "Hazel/Renderer/SubTexture2D.h"
+
+namespace Hazel
+{
+struct TilemapSpecification
+{
+    std::uint32_t width{0};  // in tiles
+    std::uint32_t height{0};
+    glm::vec2 tile_size{1.0f};
+    glm::vec3 origin{0.0f};  // bottom-left corner of tile (0, 0)
+    std::uint32_t chunk_size{32};  // chunks are chunk_size x chunk_size tiles
+    // Baked chunks that weren't visible in the latest draw are released once there are more than this many
+    std::uint32_t max_resident_chunks{1024};
+};
+
+// Grid of tiles drawn through Renderer2D. The map is split into square chunks, each baked into its own StaticBatch:
+// only chunks intersecting the camera are drawn, and a chunk is only re-baked when one of its tiles changed - lazily,
+// the next time it is visible.
+class Tilemap {
+public:
+    // Index into the tile types, 0 is an empty tile
+    using Tile = std::uint16_t;
+    static constexpr const Tile empty_tile{0};
+
+    struct Statistics {
+        std::uint32_t drawn_chunks{};
+        std::uint32_t baked_chunks{};     // chunks re-baked in the latest draw
+        std::uint32_t resident_chunks{};  // chunks currently holding GPU buffers
+    };
+
+    explicit Tilemap(TilemapSpecification const& spec);
+
+    Tile addTileType(Ref<SubTexture2D> const& subtexture, glm::vec4 const& tint_color = glm::vec4(1.0f));
+
+    // x grows to the right, y upwards
+    void setTile(std::uint32_t x, std::uint32_t y, Tile tile);
+    Tile getTile(std::uint32_t x, std::uint32_t y) const;
+
+    // Draws the chunks seen by `camera` - must be called between Renderer2D::beginScene and endScene
+    void draw(OrthographicCamera const& camera);
+
+    TilemapSpecification const& getSpecification() const noexcept { return spec_; }
+    Statistics const& getStats() const noexcept { return stats_; }
+
+private:
+    struct TileType {
+        Ref<SubTexture2D> subtexture;
+        glm::vec4 tint_color;
+    };
+
+    struct Chunk {
+        StaticBatch batch;
+        std::uint64_t last_drawn_frame{0};
+        bool dirty{true};
+        bool resident{false};
+    };
+
+    void bake(std::uint32_t chunk_x, std::uint32_t chunk_y);
+    void evictChunks();
+
+    TilemapSpecification spec_;
+    std::uint32_t chunks_x_;
+    std::uint32_t chunks_y_;
+    std::vector<Tile> tiles_;
+    std::vector<TileType> tile_types_;
+    std::vector<Chunk> chunks_;
+    std::vector<std::uint32_t> resident_chunks_;  // indices into chunks_
+    std::uint64_t frame_{0};
+    Statistics stats_;
+};
+}  // namespace Hazel
@@ -3,6 +3,7 @@
 #include "Hazel/Core/AssertionHandler.h"
 #include "Hazel/Renderer/Renderer.h"
 
+#include "Platform/Null/NullVertexArray.h"
 #include "Platform/OpenGL/OpenGLVertexArray.h"
 
 namespace Hazel {
@@ -15,6 +16,8 @@ Scope<VertexArray> VertexArray::create()
                   "RendererAPI::API::None is currently not supported");
     case RendererAPI::API::OpenGL:
         return makeScope<OpenGLVertexArray>();
+    case RendererAPI::API::Null:
+        return makeScope<NullVertexArray>();
     default:
         HZ_EXPECTS(false, DefaultCoreHandler, Hazel::Enforce, "Unknown RendererAPI::API");
     }
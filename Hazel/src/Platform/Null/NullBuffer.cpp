@@ -0,0 +1,58 @@
+#include "NullBuffer.h"
+
+#include <cstring>
+
+#include "Hazel/Core/AssertionHandler.h"
+#include "Platform/Null/NullRecorder.h"
+
+namespace Hazel {
+// --- NullVertexBuffer ---
+// ------------------------------------------------------------------------------------------------
+NullVertexBuffer::NullVertexBuffer(const std::uint32_t size) : data_(size) {}
+
+NullVertexBuffer::NullVertexBuffer(const float* vertices, const std::uint32_t size) : data_(size)
+{
+    std::memcpy(data_.data(), vertices, size);
+}
+
+void NullVertexBuffer::setData(const void* data, std::uint32_t size)
+{
+    HZ_EXPECTS(size <= data_.size(), DefaultCoreHandler, Enforce, "VertexBuffer data exceeds the buffer size");
+    std::memcpy(data_.data(), data, size);
+    NullRecorder::get().recordVertexUpload(size);
+}
+// ------------------------------------------------------------------------------------------------
+
+// --- NullStreamingVertexBuffer ---
+// ------------------------------------------------------------------------------------------------
+NullStreamingVertexBuffer::NullStreamingVertexBuffer(const std::uint32_t region_size,
+                                                     const std::uint32_t region_count)
+    : data_(static_cast<std::size_t>(region_size) * region_count), region_size_{region_size},
+      region_count_{region_count}
+{
+    HZ_EXPECTS(region_count != 0, DefaultCoreHandler, Enforce, "StreamingVertexBuffer needs at least one region");
+}
+
+void NullStreamingVertexBuffer::setData(const void* data, std::uint32_t size)
+{
+    HZ_EXPECTS(size <= region_size_, DefaultCoreHandler, Enforce, "Data exceeds the streaming buffer region");
+    std::memcpy(map(), data, size);
+    commit(size);
+}
+
+void NullStreamingVertexBuffer::commit(std::uint32_t size)
+{
+    HZ_EXPECTS(size <= region_size_, DefaultCoreHandler, Enforce, "Data exceeds the streaming buffer region");
+    NullRecorder::get().recordVertexUpload(size);
+}
+// ------------------------------------------------------------------------------------------------
+
+// --- NullIndexBuffer ---
+// ------------------------------------------------------------------------------------------------
+NullIndexBuffer::NullIndexBuffer(const std::uint32_t* indices, const std::uint32_t size)
+    : indices_(indices, indices + size)
+{
+}
+// ------------------------------------------------------------------------------------------------
+
+}  // namespace Hazel
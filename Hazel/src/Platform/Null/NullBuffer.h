@@ -0,0 +1,74 @@
+#pragma once
+
+#include <vector>
+
+#include "Hazel/Renderer/Buffer.h"
+
+namespace Hazel {
+class NullVertexBuffer : public VertexBuffer {
+public:
+    NullVertexBuffer(const std::uint32_t size);
+    NullVertexBuffer(const float* vertices, const std::uint32_t size);
+    ~NullVertexBuffer() override = default;
+    NullVertexBuffer& operator=(NullVertexBuffer&&) = delete;
+
+    void setData(const void* data, std::uint32_t size) override;
+    const BufferLayout& getLayout() const noexcept override { return layout_; }
+    void setLayout(BufferLayout const& layout) override { layout_ = layout; }
+    void bind() const noexcept override {}
+    void unbind() const noexcept override {}
+
+    std::vector<std::byte> const& getData() const noexcept { return data_; }
+
+private:
+    std::vector<std::byte> data_;
+    BufferLayout layout_;
+};
+
+// Regions live in system memory, there is never anything to wait for.
+// Committed bytes are recorded as vertex uploads - that is what the GPU would read.
+class NullStreamingVertexBuffer : public StreamingVertexBuffer {
+public:
+    NullStreamingVertexBuffer(const std::uint32_t region_size, const std::uint32_t region_count);
+    ~NullStreamingVertexBuffer() override = default;
+    NullStreamingVertexBuffer& operator=(NullStreamingVertexBuffer&&) = delete;
+
+    void setData(const void* data, std::uint32_t size) override;
+    const BufferLayout& getLayout() const noexcept override { return layout_; }
+    void setLayout(BufferLayout const& layout) override { layout_ = layout; }
+    void bind() const noexcept override {}
+    void unbind() const noexcept override {}
+
+    void* map() noexcept override { return data_.data() + getRegionOffset(); }
+    void commit(std::uint32_t size) override;
+    void advance() noexcept override { region_ = (region_ + 1) % region_count_; }
+
+    std::uint32_t getRegionSize() const noexcept override { return region_size_; }
+    std::uint32_t getRegionOffset() const noexcept override { return region_ * region_size_; }
+
+    std::vector<std::byte> const& getData() const noexcept { return data_; }
+
+private:
+    std::vector<std::byte> data_;
+    std::uint32_t region_size_;
+    std::uint32_t region_count_;
+    std::uint32_t region_{0};
+    BufferLayout layout_;
+};
+
+class NullIndexBuffer : public IndexBuffer {
+public:
+    NullIndexBuffer(const std::uint32_t* indices, const std::uint32_t size);
+    ~NullIndexBuffer() override = default;
+    NullIndexBuffer& operator=(NullIndexBuffer&&) = delete;
+
+    void bind() const noexcept override {}
+    void unbind() const noexcept override {}
+    std::uint32_t getCount() const noexcept override { return static_cast<std::uint32_t>(indices_.size()); }
+
+    std::vector<std::uint32_t> const& getIndices() const noexcept { return indices_; }
+
+private:
+    std::vector<std::uint32_t> indices_;
+};
+}  // namespace Hazel
@@ -0,0 +1,12 @@
+#include "NullFramebuffer.h"
+
+namespace Hazel {
+NullFramebuffer::NullFramebuffer(FramebufferSpecification const& spec) : spec_{spec} {}
+
+void NullFramebuffer::resize(std::uint32_t width, std::uint32_t height)
+{
+    spec_.width = width;
+    spec_.height = height;
+}
+
+}  // namespace Hazel
@@ -0,0 +1,24 @@
+#pragma once
+
+#include "Hazel/Renderer/Framebuffer.h"
+
+namespace Hazel
+{
+class NullFramebuffer final : public Framebuffer {
+public:
+    explicit NullFramebuffer(FramebufferSpecification const& spec);
+    ~NullFramebuffer() override = default;
+
+    void resize(std::uint32_t width, std::uint32_t height) override;
+
+    void bind() noexcept override {}
+    void unbind() noexcept override {}
+
+    std::uint32_t getColorAttachmentRendererId() const noexcept override { return color_attachment_; }
+
+    FramebufferSpecification const& getSpecification() const noexcept override { return spec_; }
+private:
+    std::uint32_t color_attachment_{0};
+    FramebufferSpecification spec_;
+};
+} // namespace Hazel
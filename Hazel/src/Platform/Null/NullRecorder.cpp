@@ -0,0 +1,42 @@
+#include "NullRecorder.h"
+
+#include "Hazel/Core/AssertionHandler.h"
+
+namespace Hazel {
+
+void NullRecorder::reset() noexcept
+{
+    bound_textures_.fill(0);
+    bound_texture_count_ = 0;
+    vertex_bytes_uploaded_ = 0;
+    vertex_upload_count_ = 0;
+    texture_bind_count_ = 0;
+    clear_count_ = 0;
+    indices_drawn_ = 0;
+    draw_calls_.clear();
+}
+
+void NullRecorder::recordTextureBind(std::uint32_t slot, std::uint32_t texture_id) noexcept
+{
+    HZ_EXPECTS(slot < NullDrawCall::max_texture_slots, DefaultCoreHandler, Enforce, "Texture slot out of range");
+    bound_textures_[slot] = texture_id;
+    bound_texture_count_ = std::max(bound_texture_count_, slot + 1);
+    ++texture_bind_count_;
+}
+
+void NullRecorder::recordDraw(std::uint32_t index_count, std::uint32_t instance_count)
+{
+    NullDrawCall draw_call{};
+    draw_call.index_count = index_count;
+    draw_call.instance_count = instance_count;
+    draw_call.bound_texture_count = bound_texture_count_;
+    draw_call.textures = bound_textures_;
+    draw_calls_.push_back(draw_call);
+    indices_drawn_ += static_cast<std::uint64_t>(index_count) * instance_count;
+
+    // Mirror OpenGLRendererAPI::drawIndexed, which unbinds textures after every draw
+    bound_textures_.fill(0);
+    bound_texture_count_ = 0;
+}
+
+}  // namespace Hazel
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace Hazel {
+
+// A single draw call submitted to the Null backend, together with the textures that were bound
+// at the time it was issued
+struct NullDrawCall {
+    static constexpr const std::uint32_t max_texture_slots{32};
+
+    std::uint32_t index_count{0};
+    std::uint32_t instance_count{1};
+    std::uint32_t bound_texture_count{0};
+    std::array<std::uint32_t, max_texture_slots> textures{};
+};
+
+// In-memory record of everything the Null backend was asked to do.
+// Used to inspect and measure the CPU side of the renderer on machines without a GPU.
+class NullRecorder {
+public:
+    void reset() noexcept;
+
+    void recordVertexUpload(std::uint32_t size) noexcept
+    {
+        ++vertex_upload_count_;
+        vertex_bytes_uploaded_ += size;
+    }
+    void recordTextureBind(std::uint32_t slot, std::uint32_t texture_id) noexcept;
+    void recordDraw(std::uint32_t index_count, std::uint32_t instance_count = 1);
+    void recordClear() noexcept { ++clear_count_; }
+
+    std::uint64_t getVertexBytesUploaded() const noexcept { return vertex_bytes_uploaded_; }
+    std::uint32_t getVertexUploadCount() const noexcept { return vertex_upload_count_; }
+    std::uint32_t getTextureBindCount() const noexcept { return texture_bind_count_; }
+    std::uint32_t getClearCount() const noexcept { return clear_count_; }
+    std::uint64_t getIndicesDrawn() const noexcept { return indices_drawn_; }
+    std::vector<NullDrawCall> const& getDrawCalls() const noexcept { return draw_calls_; }
+
+    static NullRecorder& get() noexcept
+    {
+        static NullRecorder instance;
+        return instance;
+    }
+
+private:
+    std::array<std::uint32_t, NullDrawCall::max_texture_slots> bound_textures_{};
+    std::uint32_t bound_texture_count_{0};
+
+    std::uint64_t vertex_bytes_uploaded_{0};
+    std::uint32_t vertex_upload_count_{0};
+    std::uint32_t texture_bind_count_{0};
+    std::uint32_t clear_count_{0};
+    std::uint64_t indices_drawn_{0};
+    std::vector<NullDrawCall> draw_calls_{};
+};
+
+}  // namespace Hazel
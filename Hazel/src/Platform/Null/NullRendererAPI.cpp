@@ -0,0 +1,32 @@
+#include "NullRendererAPI.h"
+
+#include "Platform/Null/NullRecorder.h"
+
+namespace Hazel {
+
+void NullRendererAPI::setViewport(unsigned x, unsigned y, unsigned width, unsigned height)
+{
+    viewport_ = glm::uvec4{x, y, width, height};
+}
+
+void NullRendererAPI::clear() { NullRecorder::get().recordClear(); }
+
+void NullRendererAPI::drawIndexed(VertexArray const& vertex_array, std::uint32_t index_count,
+                                  std::uint32_t /* base_vertex */)
+{
+    auto const count = [&]() noexcept {
+        if (index_count != 0)
+            return index_count;
+        else
+            return vertex_array.getIndexBuffer().getCount();
+    }();
+    NullRecorder::get().recordDraw(count);
+}
+
+void NullRendererAPI::drawIndexedInstanced(VertexArray const& /* vertex_array */, std::uint32_t index_count,
+                                           std::uint32_t instance_count, std::uint32_t /* base_instance */)
+{
+    NullRecorder::get().recordDraw(index_count, instance_count);
+}
+
+}  // namespace Hazel
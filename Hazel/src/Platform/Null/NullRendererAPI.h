@@ -0,0 +1,31 @@
+#pragma once
+
+#include "Hazel/Renderer/RendererAPI.h"
+
+namespace Hazel {
+// Headless RendererAPI - draw calls are recorded in the NullRecorder instead of being sent to a GPU
+class NullRendererAPI : public RendererAPI {
+public:
+    void init() override {}
+    void setViewport(unsigned x, unsigned y, unsigned width, unsigned height) override;
+    void setClearColor(glm::vec4 const& color) override { clear_color_ = color; }
+    void clear() override;
+    void drawIndexed(VertexArray const&, std::uint32_t index_count = 0, std::uint32_t base_vertex = 0) override;
+    void drawIndexedInstanced(VertexArray const&, std::uint32_t index_count, std::uint32_t instance_count,
+                              std::uint32_t base_instance = 0) override;
+    // Shaders never run here - captureInstances leaves the destination untouched
+    bool supportsTransformFeedback() const noexcept override { return false; }
+    void captureInstances(VertexArray const&, std::uint32_t /* instance_count */, VertexBuffer& /* destination */,
+                          std::uint32_t /* offset */ = 0) override
+    {
+    }
+
+    glm::vec4 const& getClearColor() const noexcept { return clear_color_; }
+    glm::uvec4 const& getViewport() const noexcept { return viewport_; }
+
+private:
+    glm::vec4 clear_color_{0.0f};
+    glm::uvec4 viewport_{0};
+};
+
+}  // namespace Hazel
@@ -0,0 +1,46 @@
+#include "NullShader.h"
+
+namespace Hazel {
+
+NullShader::NullShader(const std::string& filepath)
+{
+    // get name from filepath - the source itself is never read, shader assets don't have to be present
+    auto last_slash{filepath.find_last_of("/\\")};
+    last_slash = last_slash == std::string::npos ? 0 : last_slash + 1;
+    auto const last_dot{filepath.rfind('.')};
+    auto count{last_dot == std::string::npos ? filepath.size() - last_slash : last_dot - last_slash};
+    name_ = filepath.substr(last_slash, count);
+}
+
+NullShader::NullShader(const std::string& name, const std::string& /* vertex_src */,
+                       const std::string& /* fragment_src */)
+    : name_{name}
+{
+}
+
+void NullShader::setUniform(std::string const& name, int value) { uniforms_[name] = value; }
+
+void NullShader::setUniform(std::string const& name, const int* values, std::uint32_t count)
+{
+    uniforms_[name] = std::vector<int>(values, values + count);
+}
+
+void NullShader::setUniform(std::string const& name, float value) { uniforms_[name] = value; }
+
+void NullShader::setUniform(std::string const& name, glm::vec2 const& values) { uniforms_[name] = values; }
+
+void NullShader::setUniform(std::string const& name, glm::vec3 const& values) { uniforms_[name] = values; }
+
+void NullShader::setUniform(std::string const& name, glm::vec4 const& values) { uniforms_[name] = values; }
+
+void NullShader::setUniform(std::string const& name, glm::mat3 const& uniform) { uniforms_[name] = uniform; }
+
+void NullShader::setUniform(std::string const& name, glm::mat4 const& uniform) { uniforms_[name] = uniform; }
+
+const NullShader::UniformValue* NullShader::findUniform(std::string const& name) const noexcept
+{
+    auto const it{uniforms_.find(name)};
+    return it != uniforms_.cend() ? &it->second : nullptr;
+}
+
+}  // namespace Hazel
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <variant>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "Hazel/Renderer/Shader.h"
+
+namespace Hazel {
+// Shader for the Null backend - nothing is compiled, uniforms are stored so they can be inspected
+class NullShader : public Shader {
+public:
+    using UniformValue =
+        std::variant<int, std::vector<int>, float, glm::vec2, glm::vec3, glm::vec4, glm::mat3, glm::mat4>;
+
+    explicit NullShader(const std::string& filepath);
+    NullShader(const std::string& name, const std::string& vertex_src, const std::string& fragment_src);
+    ~NullShader() noexcept override = default;
+    NullShader& operator=(NullShader&&) noexcept = delete;
+
+    void bind() const override {}
+    void unbind() const override {}
+    void setUniform(std::string const& name, int value) override;
+    void setUniform(std::string const& name, const int* values, std::uint32_t count) override;
+    void setUniform(std::string const& name, float value) override;
+    void setUniform(std::string const& name, glm::vec2 const& values) override;
+    void setUniform(std::string const& name, glm::vec3 const& values) override;
+    void setUniform(std::string const& name, glm::vec4 const& values) override;
+    void setUniform(std::string const& name, glm::mat3 const& uniform) override;
+    void setUniform(std::string const& name, glm::mat4 const& uniform) override;
+
+    const std::string& getName() const noexcept override { return name_; }
+
+    // Returns nullptr if the uniform was never set
+    const UniformValue* findUniform(std::string const& name) const noexcept;
+
+private:
+    std::string name_;
+    std::unordered_map<std::string, UniformValue> uniforms_;
+};
+}  // namespace Hazel
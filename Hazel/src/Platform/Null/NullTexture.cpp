@@ -0,0 +1,51 @@
+#include "NullTexture.h"
+
+#include <stb/stb_image.h>
+
+#include <atomic>
+#include <cstring>
+#include <utility>
+
+#include "Hazel/Core/AssertionHandler.h"
+#include "Platform/Null/NullRecorder.h"
+
+namespace Hazel {
+
+std::uint32_t NullTexture2D::nextRendererId() noexcept
+{
+    static std::atomic<std::uint32_t> s_next_id{1};  // 0 is reserved for "no texture", same as in OpenGL
+    return s_next_id.fetch_add(1, std::memory_order_relaxed);
+}
+
+NullTexture2D::NullTexture2D(unsigned width, unsigned height)
+    : width_{width}, height_{height}, pixels_(static_cast<std::size_t>(width) * height * 4)
+{
+}
+
+NullTexture2D::NullTexture2D(std::string path) : path_{std::move(path)}
+{
+    HZ_PROFILE_FUNCTION();
+
+    int width, height, channels;
+    stbi_set_flip_vertically_on_load(true);
+    stbi_uc* data{stbi_load(path_.c_str(), &width, &height, &channels, 0)};
+    HZ_EXPECTS(data != nullptr, DefaultCoreHandler, Hazel::Enforce, "Failed to load image");
+    HZ_EXPECTS(channels == 3 || channels == 4, DefaultCoreHandler, Hazel::Enforce, "Unsupported texture format");
+    width_ = width;
+    height_ = height;
+    channels_ = channels;
+    pixels_.assign(data, data + static_cast<std::size_t>(width_) * height_ * channels_);
+
+    stbi_image_free(data);
+}
+
+void NullTexture2D::bind(std::uint32_t slot) const { NullRecorder::get().recordTextureBind(slot, renderer_id_); }
+
+void NullTexture2D::setData(const void* data, unsigned size) noexcept
+{
+    HZ_EXPECTS(size == width_ * height_ * channels_, DefaultCoreHandler, Hazel::Enforce,
+               "Data must be entire texture");
+    std::memcpy(pixels_.data(), data, size);
+}
+
+}  // namespace Hazel
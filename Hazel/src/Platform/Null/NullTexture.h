@@ -0,0 +1,44 @@
+#pragma once
+
+#include <vector>
+
+#include "Hazel/Renderer/Texture.h"
+
+namespace Hazel
+{
+// Texture kept entirely in system memory. Renderer ids are unique per process, bind calls are recorded in the
+// NullRecorder.
+class NullTexture2D : public Texture2D {
+public:
+    NullTexture2D(unsigned width, unsigned height);
+    NullTexture2D(std::string path);
+    ~NullTexture2D() noexcept override = default;
+    NullTexture2D& operator=(NullTexture2D&&) = delete;
+
+    std::uint32_t getWidth() const noexcept override final { return width_; }
+    std::uint32_t getHeight() const noexcept override final { return height_; }
+    std::uint32_t getRendererId() const noexcept override final { return renderer_id_; }
+
+    void setData(const void* data, unsigned size) noexcept override;
+
+    void bind(std::uint32_t slot) const override;
+
+    std::vector<std::uint8_t> const& getPixels() const noexcept { return pixels_; }
+    std::uint32_t getChannels() const noexcept { return channels_; }
+
+private:
+    bool do_equals(Texture const& other) const noexcept final
+    {
+        return renderer_id_ == static_cast<NullTexture2D const&>(other).renderer_id_;
+    }
+
+    static std::uint32_t nextRendererId() noexcept;
+
+    std::uint32_t renderer_id_{nextRendererId()};
+    std::uint32_t width_{0};
+    std::uint32_t height_{0};
+    std::uint32_t channels_{4};
+    std::vector<std::uint8_t> pixels_;
+    std::string path_;
+};
+} // namespace Hazel
@@ -0,0 +1,18 @@
+#include "NullVertexArray.h"
+
+namespace Hazel {
+
+void NullVertexArray::addVertexBuffer(Scope<VertexBuffer> p_vertex_buffer)
+{
+    HZ_EXPECTS(p_vertex_buffer != nullptr, DefaultCoreHandler, Enforce, "VertexBuffer* may not be nullptr");
+    HZ_EXPECTS(!p_vertex_buffer->getLayout().getElements().empty(), DefaultCoreHandler, Enforce,
+               "VertexBuffer must have a layout set");
+    vertex_buffers_.push_back(std::move(p_vertex_buffer));
+}
+
+void NullVertexArray::setIndexBuffer(Scope<IndexBuffer> p_index_buffer)
+{
+    index_buffer_ = std::move(p_index_buffer);
+}
+
+}  // namespace Hazel
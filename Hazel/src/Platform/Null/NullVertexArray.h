@@ -0,0 +1,31 @@
+#pragma once
+
+#include "Hazel/Core/AssertionHandler.h"
+
+#include "Hazel/Renderer/Buffer.h"
+#include "Hazel/Renderer/VertexArray.h"
+
+namespace Hazel {
+class NullVertexArray : public VertexArray {
+public:
+    NullVertexArray() noexcept = default;
+    ~NullVertexArray() override = default;
+    NullVertexArray& operator=(NullVertexArray&&) = delete;
+
+    void bind() const override {}
+    void unbind() const override {}
+
+    void addVertexBuffer(Scope<VertexBuffer>) override;
+    void setIndexBuffer(Scope<IndexBuffer>) override;
+
+    std::vector<Scope<VertexBuffer>> const& getVertexBuffers() const noexcept override { return vertex_buffers_; }
+    IndexBuffer const& getIndexBuffer() const noexcept override {
+        HZ_EXPECTS(index_buffer_ != nullptr, DefaultCoreHandler, Enforce, "Index buffer not set");
+        return *index_buffer_;
+    }
+
+private:
+    std::vector<Scope<VertexBuffer>> vertex_buffers_{};
+    Scope<IndexBuffer> index_buffer_{nullptr};
+};
+}  // namespace Hazel
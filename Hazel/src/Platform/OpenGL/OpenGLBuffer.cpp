@@ -1,7 +1,11 @@
 #include "OpenGLBuffer.h"
 
+#include <cstring>
+
 #include <glad/glad.h>
 
+#include "Hazel/Core/AssertionHandler.h"
+
 namespace Hazel {
 // --- OpenGLIndexBuffer ---
 // ------------------------------------------------------------------------------------------------
@@ -45,6 +49,82 @@ void OpenGLVertexBuffer::setData(const void* data, std::uint32_t size)
 }
 // ------------------------------------------------------------------------------------------------
 
+// --- OpenGLStreamingVertexBuffer ---
+// ------------------------------------------------------------------------------------------------
+namespace {
+constexpr GLbitfield streaming_buffer_flags{GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT};
+}  // namespace
+
+OpenGLStreamingVertexBuffer::OpenGLStreamingVertexBuffer(const std::uint32_t region_size,
+                                                         const std::uint32_t region_count)
+    : region_size_{region_size}, fences_(region_count, nullptr)
+{
+    HZ_PROFILE_FUNCTION();
+    HZ_EXPECTS(region_count != 0, DefaultCoreHandler, Enforce, "StreamingVertexBuffer needs at least one region");
+    auto const total_size{static_cast<GLsizeiptr>(region_size) * region_count};
+    glCreateBuffers(1, &renderer_id_);
+    glNamedBufferStorage(renderer_id_, total_size, nullptr, streaming_buffer_flags);
+    mapped_ = static_cast<std::byte*>(glMapNamedBufferRange(renderer_id_, 0, total_size, streaming_buffer_flags));
+    HZ_ENSURES(mapped_ != nullptr, DefaultCoreHandler, Enforce, "Failed to map the streaming vertex buffer");
+}
+
+OpenGLStreamingVertexBuffer::~OpenGLStreamingVertexBuffer()
+{
+    HZ_PROFILE_FUNCTION();
+    for (auto* fence : fences_) {
+        glDeleteSync(fence);  // no-op for nullptr
+    }
+    glUnmapNamedBuffer(renderer_id_);
+    glDeleteBuffers(1, &renderer_id_);
+}
+
+void OpenGLStreamingVertexBuffer::bind() const noexcept
+{
+    HZ_PROFILE_FUNCTION();
+    glBindBuffer(GL_ARRAY_BUFFER, renderer_id_);
+}
+
+void OpenGLStreamingVertexBuffer::unbind() const noexcept
+{
+    HZ_PROFILE_FUNCTION();
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+void OpenGLStreamingVertexBuffer::setData(const void* data, std::uint32_t size)
+{
+    HZ_EXPECTS(size <= region_size_, DefaultCoreHandler, Enforce, "Data exceeds the streaming buffer region");
+    std::memcpy(map(), data, size);
+    commit(size);
+}
+
+void* OpenGLStreamingVertexBuffer::map()
+{
+    if (auto* const fence{fences_[region_]}) {
+        HZ_PROFILE_SCOPE("OpenGLStreamingVertexBuffer::map - wait");
+        // Poll first - only flush the command queue if the GPU is actually still reading this region
+        auto result{glClientWaitSync(fence, 0, 0)};
+        while (result == GL_TIMEOUT_EXPIRED) {
+            result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1'000'000);  // 1 ms
+        }
+        glDeleteSync(fence);
+        fences_[region_] = nullptr;
+    }
+    return mapped_ + getRegionOffset();
+}
+
+void OpenGLStreamingVertexBuffer::commit(std::uint32_t size)
+{
+    // The mapping is coherent, the writes are visible to subsequently issued draw calls without a flush
+    HZ_EXPECTS(size <= region_size_, DefaultCoreHandler, Enforce, "Data exceeds the streaming buffer region");
+}
+
+void OpenGLStreamingVertexBuffer::advance()
+{
+    fences_[region_] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    region_ = (region_ + 1) % static_cast<std::uint32_t>(fences_.size());
+}
+// ------------------------------------------------------------------------------------------------
+
 // --- OpenGLIndexBuffer ---
 // ------------------------------------------------------------------------------------------------
 OpenGLIndexBuffer::OpenGLIndexBuffer(const std::uint32_t* indices, const std::uint32_t size) : count_{size}
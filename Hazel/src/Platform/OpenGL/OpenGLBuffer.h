@@ -1,7 +1,12 @@
 #pragma once
 
+#include <cstddef>
+#include <vector>
+
 #include "Hazel/Renderer/Buffer.h"
 
+struct __GLsync;  // GLsync, without pulling in the OpenGL headers
+
 namespace Hazel {
 class OpenGLVertexBuffer : public VertexBuffer {
 public:
@@ -16,8 +21,39 @@ public:
     void bind() const noexcept override;
     void unbind() const noexcept override;
 
+    std::uint32_t getRendererId() const noexcept { return renderer_id_; }
+
+private:
+    std::uint32_t renderer_id_;
+    BufferLayout layout_;
+};
+
+// Persistently and coherently mapped buffer (glBufferStorage), with a glFenceSync per region
+class OpenGLStreamingVertexBuffer : public StreamingVertexBuffer {
+public:
+    OpenGLStreamingVertexBuffer(const std::uint32_t region_size, const std::uint32_t region_count);
+    ~OpenGLStreamingVertexBuffer() override;
+    OpenGLStreamingVertexBuffer& operator=(OpenGLStreamingVertexBuffer&&) = delete;
+
+    void setData(const void* data, std::uint32_t size) override;
+    const BufferLayout& getLayout() const noexcept override { return layout_; }
+    void setLayout(BufferLayout const& layout) override { layout_ = layout; }
+    void bind() const noexcept override;
+    void unbind() const noexcept override;
+
+    void* map() override;
+    void commit(std::uint32_t size) override;
+    void advance() override;
+
+    std::uint32_t getRegionSize() const noexcept override { return region_size_; }
+    std::uint32_t getRegionOffset() const noexcept override { return region_ * region_size_; }
+
 private:
     std::uint32_t renderer_id_;
+    std::uint32_t region_size_;
+    std::uint32_t region_{0};
+    std::byte* mapped_{nullptr};
+    std::vector<__GLsync*> fences_;
     BufferLayout layout_;
 };
 
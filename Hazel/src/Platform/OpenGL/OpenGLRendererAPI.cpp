@@ -2,6 +2,9 @@
 
 #include <glad/glad.h>
 
+#include "Hazel/Core/AssertionHandler.h"
+#include "Platform/OpenGL/OpenGLBuffer.h"
+
 namespace Hazel {
 
 void OpenGLRendererAPI::init()
@@ -21,7 +24,8 @@ void OpenGLRendererAPI::setClearColor(glm::vec4 const& color) { glClearColor(col
 
 void OpenGLRendererAPI::clear() { glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT); }
 
-void OpenGLRendererAPI::drawIndexed(VertexArray const& vertex_array, std::uint32_t index_count)
+void OpenGLRendererAPI::drawIndexed(VertexArray const& vertex_array, std::uint32_t index_count,
+                                    std::uint32_t base_vertex)
 {
     auto const count = [&]() noexcept {
         if (index_count != 0)
@@ -29,8 +33,39 @@ void OpenGLRendererAPI::drawIndexed(VertexArray const& vertex_array, std::uint32
         else
             return vertex_array.getIndexBuffer().getCount();
     }();
-    glDrawElements(GL_TRIANGLES, count, GL_UNSIGNED_INT, nullptr);
+    if (base_vertex != 0) {
+        glDrawElementsBaseVertex(GL_TRIANGLES, count, GL_UNSIGNED_INT, nullptr, static_cast<GLint>(base_vertex));
+    }
+    else {
+        glDrawElements(GL_TRIANGLES, count, GL_UNSIGNED_INT, nullptr);
+    }
+    glBindTexture(GL_TEXTURE_2D, 0);
+}
+
+void OpenGLRendererAPI::drawIndexedInstanced(VertexArray const& /* vertex_array */, std::uint32_t index_count,
+                                             std::uint32_t instance_count, std::uint32_t base_instance)
+{
+    glDrawElementsInstancedBaseInstance(GL_TRIANGLES, index_count, GL_UNSIGNED_INT, nullptr, instance_count,
+                                        base_instance);
     glBindTexture(GL_TEXTURE_2D, 0);
 }
 
+void OpenGLRendererAPI::captureInstances(VertexArray const& vertex_array, std::uint32_t instance_count,
+                                         VertexBuffer& destination, std::uint32_t offset)
+{
+    auto const* gl_destination{dynamic_cast<OpenGLVertexBuffer const*>(&destination)};
+    HZ_EXPECTS(gl_destination != nullptr, DefaultCoreHandler, Hazel::Enforce,
+               "Instances can only be captured into an OpenGLVertexBuffer");
+
+    auto const size{instance_count * destination.getLayout().getStride()};
+    glEnable(GL_RASTERIZER_DISCARD);
+    glBindBufferRange(GL_TRANSFORM_FEEDBACK_BUFFER, 0, gl_destination->getRendererId(), offset, size);
+    vertex_array.bind();
+    glBeginTransformFeedback(GL_POINTS);
+    glDrawArraysInstanced(GL_POINTS, 0, 1, static_cast<GLsizei>(instance_count));
+    glEndTransformFeedback();
+    glBindBufferBase(GL_TRANSFORM_FEEDBACK_BUFFER, 0, 0);
+    glDisable(GL_RASTERIZER_DISCARD);
+}
+
 }  // namespace Hazel
@@ -10,7 +10,12 @@ public:
     void setViewport(unsigned x, unsigned y, unsigned width, unsigned height) override;
     void setClearColor(glm::vec4 const& color) override;
     void clear() override;
-    void drawIndexed(VertexArray const&, std::uint32_t index_count = 0) override;
+    void drawIndexed(VertexArray const&, std::uint32_t index_count = 0, std::uint32_t base_vertex = 0) override;
+    void drawIndexedInstanced(VertexArray const&, std::uint32_t index_count, std::uint32_t instance_count,
+                              std::uint32_t base_instance = 0) override;
+    bool supportsTransformFeedback() const noexcept override { return true; }
+    void captureInstances(VertexArray const&, std::uint32_t instance_count, VertexBuffer& destination,
+                          std::uint32_t offset = 0) override;
 };
 
 }  // namespace Hazel
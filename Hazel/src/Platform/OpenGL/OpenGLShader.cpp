@@ -26,13 +26,15 @@ static GLenum shaderTypeFromString(const std::string& type) noexcept
     return 0;
 }
 
-OpenGLShader::OpenGLShader(const std::string& filepath)
+OpenGLShader::OpenGLShader(const std::string& filepath) : OpenGLShader{filepath, {}} {}
+
+OpenGLShader::OpenGLShader(const std::string& filepath, const std::vector<std::string>& captured_outputs)
 {
     HZ_PROFILE_FUNCTION();
 
     const std::string source = readFile(filepath);
     const auto shader_sources{preProcess(source)};
-    compile(shader_sources);
+    compile(shader_sources, captured_outputs);
 
     // get name from filepath
     auto last_slash{filepath.find_last_of("/\\")};
@@ -112,7 +114,8 @@ std::unordered_map<GLenum, std::string> OpenGLShader::preProcess(const std::stri
     return shader_sources;
 }
 
-void OpenGLShader::compile(const std::unordered_map<GLenum, std::string>& shader_src)
+void OpenGLShader::compile(const std::unordered_map<GLenum, std::string>& shader_src,
+                           const std::vector<std::string>& captured_outputs)
 {
     HZ_PROFILE_FUNCTION();
     std::array<GLenum, 4> gl_shader_ids;
@@ -169,6 +172,16 @@ void OpenGLShader::compile(const std::unordered_map<GLenum, std::string>& shader
     for (auto i{0}; i < index; ++i) {
         glAttachShader(program, gl_shader_ids[i]);
     }
+    // Transform feedback outputs have to be declared before linking
+    if (!captured_outputs.empty()) {
+        std::vector<const GLchar*> varyings;
+        varyings.reserve(captured_outputs.size());
+        for (auto const& output : captured_outputs) {
+            varyings.push_back(output.c_str());
+        }
+        glTransformFeedbackVaryings(program, static_cast<GLsizei>(varyings.size()), varyings.data(),
+                                    GL_INTERLEAVED_ATTRIBS);
+    }
     // Link our program
     glLinkProgram(program);
 
@@ -3,12 +3,15 @@
 #include <glad/glad.h>
 #include <glm/glm.hpp>
 
+#include <vector>
+
 #include <Hazel/Renderer/Shader.h>
 
 namespace Hazel {
 class OpenGLShader : public Shader {
 public:
     OpenGLShader(const std::string& filepath);
+    OpenGLShader(const std::string& filepath, const std::vector<std::string>& captured_outputs);
     OpenGLShader(const std::string& name, const std::string& vertex_src, const std::string& fragment_src);
     OpenGLShader(OpenGLShader const&) noexcept = default;
     OpenGLShader(OpenGLShader&&) noexcept = default;
@@ -41,7 +44,8 @@ public:
 private:
     std::string readFile(const std::string& filepath);
     std::unordered_map<GLenum, std::string> preProcess(const std::string shader_src);
-    void compile(const std::unordered_map<GLenum, std::string>& shader_src);
+    void compile(const std::unordered_map<GLenum, std::string>& shader_src,
+                 const std::vector<std::string>& captured_outputs = {});
 
     std::uint32_t renderer_id_;
     std::string name_;
@@ -21,6 +21,8 @@ constexpr GLenum shaderDataTypeToPlatformType<GLenum>(ShaderDataType type) noexc
         case ShaderDataType::Int2  :    return GL_INT;
         case ShaderDataType::Int3  :    return GL_INT;
         case ShaderDataType::Int4  :    return GL_INT;
+        case ShaderDataType::UByte4:    return GL_UNSIGNED_BYTE;
+        case ShaderDataType::UShort2:   return GL_UNSIGNED_SHORT;
         case ShaderDataType::Bool  :    return GL_BOOL;
     }
     // clang-format on
@@ -52,7 +54,8 @@ void OpenGLVertexArray::unbind() const
     glBindVertexArray(0);
 }
 
-inline void OpenGLVertexArray::defineVertexAttributeArray(BufferElement const& element, std::uint32_t stride) noexcept
+inline void OpenGLVertexArray::defineVertexAttributeArray(BufferElement const& element, std::uint32_t stride,
+                                                          std::uint32_t divisor) noexcept
 {
     const auto count{componentCount(element.type)};
     const auto native_type{shaderDataTypeToPlatformType<GLenum>(element.type)};
@@ -62,21 +65,43 @@ inline void OpenGLVertexArray::defineVertexAttributeArray(BufferElement const& e
     case ShaderDataType::Float2:
     case ShaderDataType::Float3:
     case ShaderDataType::Float4:
+    case ShaderDataType::Bool: {
+        glEnableVertexAttribArray(vertex_buffer_index_);
+        glVertexAttribPointer(vertex_buffer_index_, count, native_type, is_normalized, stride,
+                              reinterpret_cast<const void*>(element.offset));
+        glVertexAttribDivisor(vertex_buffer_index_, divisor);
+        ++vertex_buffer_index_;
+        break;
+    }
     case ShaderDataType::Int:
     case ShaderDataType::Int2:
     case ShaderDataType::Int3:
     case ShaderDataType::Int4:
-    case ShaderDataType::Bool: {
-        glVertexAttribPointer(vertex_buffer_index_, count, native_type, is_normalized, stride,
-                              reinterpret_cast<const void*>(element.offset));
+    case ShaderDataType::UByte4:
+    case ShaderDataType::UShort2: {
+        glEnableVertexAttribArray(vertex_buffer_index_);
+        if (element.normalized) {
+            glVertexAttribPointer(vertex_buffer_index_, count, native_type, GL_TRUE, stride,
+                                  reinterpret_cast<const void*>(element.offset));
+        }
+        else {
+            // Integer inputs (`in int`, `in uint`...) must not be converted to floating point on the way
+            glVertexAttribIPointer(vertex_buffer_index_, count, native_type, stride,
+                                   reinterpret_cast<const void*>(element.offset));
+        }
+        glVertexAttribDivisor(vertex_buffer_index_, divisor);
+        ++vertex_buffer_index_;
         break;
     }
     case ShaderDataType::Mat3:
     case ShaderDataType::Mat4: {
+        // Matrices occupy one attribute location per column
         for (std::uint32_t i{0}; i != count; ++i) {
+            glEnableVertexAttribArray(vertex_buffer_index_);
             glVertexAttribPointer(vertex_buffer_index_, count, native_type, is_normalized, stride,
-                                  reinterpret_cast<const void*>(sizeof(float) * count * i));
-            glVertexAttribDivisor(vertex_buffer_index_, 1);
+                                  reinterpret_cast<const void*>(element.offset + sizeof(float) * count * i));
+            glVertexAttribDivisor(vertex_buffer_index_, divisor);
+            ++vertex_buffer_index_;
         }
         break;
     }
@@ -96,10 +121,9 @@ void OpenGLVertexArray::addVertexBuffer(Scope<VertexBuffer> p_vertex_buffer)
     p_vertex_buffer->bind();
 
     auto const& vb_layout{p_vertex_buffer->getLayout()};
+    auto const divisor{vb_layout.getStepRate() == VertexStepRate::PerInstance ? 1u : 0u};
     for (const auto& element : vb_layout) {
-        glEnableVertexAttribArray(vertex_buffer_index_);
-        defineVertexAttributeArray(element, vb_layout.getStride());
-        ++vertex_buffer_index_;
+        defineVertexAttributeArray(element, vb_layout.getStride(), divisor);
     }
 
     vertex_buffers_.push_back(std::move(p_vertex_buffer));
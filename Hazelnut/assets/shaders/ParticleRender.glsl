@@ -0,0 +1,46 @@
+#type vertex
+#version 450 core
+
+// Per-instance particle state, in the layout written by ParticleUpdate.glsl - the unit quad is expanded from
+// gl_VertexID
+layout(location = 0) in vec2 a_position;
+layout(location = 1) in vec2 a_velocity;
+layout(location = 2) in vec2 a_rotation;
+layout(location = 3) in vec2 a_life;
+layout(location = 4) in vec2 a_size;
+layout(location = 5) in vec4 a_color_begin;
+layout(location = 6) in vec4 a_color_end;
+
+uniform mat4 u_view_projection;
+uniform float u_z;
+
+out vec4 v_color;
+
+void main()
+{
+    // Fade from the begin to the end values over the particle's lifetime - dead particles collapse into a point
+    float life = a_life.x * a_life.y;
+    float size = a_life.x > 0.0 ? mix(a_size.y, a_size.x, life) : 0.0;
+
+    // corners in index buffer order: bottom-left, bottom-right, top-right, top-left
+    vec2 corner = vec2((gl_VertexID == 1 || gl_VertexID == 2) ? 0.5 : -0.5, gl_VertexID >= 2 ? 0.5 : -0.5);
+    float c = cos(a_rotation.x);
+    float s = sin(a_rotation.x);
+    vec2 offset = mat2(c, s, -s, c) * (corner * size);
+
+    v_color = mix(a_color_end, a_color_begin, life);
+    gl_Position = u_view_projection * vec4(a_position + offset, u_z, 1.0);
+}
+
+
+#type fragment
+#version 450 core
+
+layout(location = 0) out vec4 color;
+
+in vec4 v_color;
+
+void main()
+{
+    color = v_color;
+}
@@ -0,0 +1,52 @@
+#type vertex
+#version 450 core
+
+// Initializes the particles of one emission - one instance per particle, no inputs besides the emission parameters.
+// The outputs are captured in the particle layout of ParticleUpdate.glsl.
+
+uniform vec2 u_position;
+uniform vec2 u_velocity;
+uniform vec2 u_velocity_variation;
+uniform vec4 u_color_begin;
+uniform vec4 u_color_end;
+uniform vec3 u_size;  // begin, end, variation
+uniform float u_lifetime;
+uniform float u_angular_velocity;
+uniform int u_seed;
+uniform int u_instance_offset;  // of the first instance, when an emission wraps around the particle slots
+
+out vec2 v_position;
+out vec2 v_velocity;
+out vec2 v_rotation;  // angle, angular velocity
+out vec2 v_life;      // remaining, 1 / lifetime
+out vec2 v_size;      // begin, end
+out vec4 v_color_begin;
+out vec4 v_color_end;
+
+// PCG hash - one well-mixed value per particle and draw
+uint pcg_hash(uint x)
+{
+    uint state = x * 747796405u + 2891336453u;
+    uint word = ((state >> ((state >> 28u) + 4u)) ^ state) * 277803737u;
+    return (word >> 22u) ^ word;
+}
+
+// Uniformly distributed in [0, 1), from the upper 24 bits - same as Hazel::Random
+float random_float(inout uint state)
+{
+    state = pcg_hash(state);
+    return float(state >> 8u) * (1.0 / 16777216.0);
+}
+
+void main()
+{
+    uint state = pcg_hash(uint(gl_InstanceID + u_instance_offset) + pcg_hash(uint(u_seed)));
+
+    v_position = u_position;
+    v_rotation = vec2(random_float(state) * 6.28318530718, u_angular_velocity);
+    v_velocity = u_velocity + u_velocity_variation * (vec2(random_float(state), random_float(state)) - 0.5);
+    v_life = vec2(u_lifetime, 1.0 / u_lifetime);
+    v_size = vec2(u_size.x + u_size.z * (random_float(state) - 0.6), u_size.y);
+    v_color_begin = u_color_begin;
+    v_color_end = u_color_end;
+}
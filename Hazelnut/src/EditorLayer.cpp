@@ -201,6 +201,16 @@ void EditorLayer::onImGuiRender()
     ImGui::Text("Quads: %d", stats.quad_count);
     ImGui::Text("Vertices: %d", stats.getTotalVertexCount());
     ImGui::Text("Indices: %d", stats.getTotalIndexCount());
+    ImGui::Text("Culled quads: %d", stats.culled_quad_count);
+
+    auto sorted{Renderer2D::getSubmitMode() == Renderer2D::SubmitMode::Deferred};
+    if (ImGui::Checkbox("Sort quads", &sorted)) {
+        Renderer2D::setSubmitMode(sorted ? Renderer2D::SubmitMode::Deferred : Renderer2D::SubmitMode::Immediate);
+    }
+    auto culling{Renderer2D::isCullingEnabled()};
+    if (ImGui::Checkbox("Cull off-screen quads", &culling)) {
+        Renderer2D::setCulling(culling);
+    }
 
     ImGui::ColorEdit4("Square Color", glm::value_ptr(sq_color_));
     ImGui::ColorEdit4("Rectangle Color", glm::value_ptr(rect_color_));
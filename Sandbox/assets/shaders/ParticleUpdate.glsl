@@ -0,0 +1,33 @@
+#type vertex
+#version 450 core
+
+// Advances every particle by one timestep - one instance per particle, read from one state buffer and captured into
+// the other. Dead particles (remaining life <= 0) are carried along and skipped by ParticleRender.glsl.
+layout(location = 0) in vec2 a_position;
+layout(location = 1) in vec2 a_velocity;
+layout(location = 2) in vec2 a_rotation;
+layout(location = 3) in vec2 a_life;
+layout(location = 4) in vec2 a_size;
+layout(location = 5) in vec4 a_color_begin;
+layout(location = 6) in vec4 a_color_end;
+
+uniform float u_timestep;
+
+out vec2 v_position;
+out vec2 v_velocity;
+out vec2 v_rotation;
+out vec2 v_life;
+out vec2 v_size;
+out vec4 v_color_begin;
+out vec4 v_color_end;
+
+void main()
+{
+    v_position = a_position + a_velocity * u_timestep;
+    v_velocity = a_velocity;
+    v_rotation = vec2(a_rotation.x + a_rotation.y * u_timestep, a_rotation.y);
+    v_life = vec2(a_life.x - u_timestep, a_life.y);
+    v_size = a_size;
+    v_color_begin = a_color_begin;
+    v_color_end = a_color_end;
+}
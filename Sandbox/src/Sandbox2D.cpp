@@ -2,8 +2,10 @@
 
 #include <imgui/imgui.h>
 
+#include <algorithm>
 #include <chrono>
 #include <cstring>
+#include <thread>
 #include <glm/gtc/type_ptr.hpp>
 
 namespace {
@@ -74,11 +76,12 @@ void Sandbox2D::onAttach()
         sprites_.push_back(Hazel::SubTexture2D::createFromCoords(sprite_sheet_, {i, 0}, {128, 128}));
     }
 
-    // map_width_ = s_map_width;
-    // map_height_ = std::strlen(s_map_tiles) / s_map_width;
+    map_width_ = s_map_width;
+    map_height_ = static_cast<std::uint32_t>(std::strlen(s_map_tiles)) / s_map_width;
 
-    // texture_map_['D'] = Hazel::SubTexture2D::createFromCoords(sprite_sheet_, {6, 11}, {128, 128});
-    // texture_map_['W'] = Hazel::SubTexture2D::createFromCoords(sprite_sheet_, {11, 11}, {128, 128});
+    texture_map_['D'] = Hazel::SubTexture2D::createFromCoords(sprite_sheet_, {6, 11}, {128, 128});
+    texture_map_['W'] = Hazel::SubTexture2D::createFromCoords(sprite_sheet_, {11, 11}, {128, 128});
+    buildTileMap();
 
     camera_controller_.setZoomLevel(5.0f);
 }
@@ -132,31 +135,47 @@ void Sandbox2D::onUpdate(float time_delta_seconds)
     // }
     // Hazel::Renderer2D::endScene();
 
+    if (draw_tile_map_) {
+        drawTileMap();
+    }
+
     particle_system_.onUpdate(time_delta_seconds);
-    particle_system_.onRender(camera_controller_.getCamera());
+    particle_system_.onRender(camera_controller_.getCamera(), 0.2f);  // force particles on top
 }
 
-void Sandbox2D::drawTileMap()
+void Sandbox2D::buildTileMap()
 {
-    Hazel::Renderer2D::beginScene(camera_controller_.getCamera());
+    HZ_PROFILE_FUNCTION();
+
+    Hazel::TilemapSpecification spec;
+    spec.width = map_width_;
+    spec.height = map_height_;
+    // same placement as one drawQuad per tile centered at (x - width / 2, height / 2 - y)
+    spec.origin = {-(map_width_ / 2.0f) - 0.5f, -(map_height_ / 2.0f) + 0.5f, 0.2f};
+    tile_map_ = Hazel::makeScope<Hazel::Tilemap>(spec);
+
+    std::unordered_map<char, Hazel::Tilemap::Tile> tiles;
+    for (auto const& [tile_type, subtexture] : texture_map_) {
+        tiles[tile_type] = tile_map_->addTileType(subtexture);
+    }
+    auto const error_tile{tile_map_->addTileType(texture_stairs_)};
+
     for (std::uint32_t y{0}; y != map_height_; ++y) {
         for (std::uint32_t x{0}; x != map_width_; ++x) {
-            const char tile_type{s_map_tiles[x + y * map_width_]};
-            const Hazel::Ref<Hazel::SubTexture2D> texture = [&]() noexcept {
-                auto const it{texture_map_.find(tile_type)};
-                if (it != texture_map_.cend()) {
-                    return it->second;
-                }
-                else {
-                    return this->texture_stairs_;  // "error" texture
-                }
-            }();
-            Hazel::Renderer2D::drawQuad({x - map_width_ / 2.0f, map_height_ / 2.0f - y, 0.2f}, {1.0f, 1.0f}, texture);
+            auto const it{tiles.find(s_map_tiles[x + y * map_width_])};
+            // the map rows are listed top to bottom
+            tile_map_->setTile(x, map_height_ - 1 - y, it != tiles.cend() ? it->second : error_tile);
         }
-        Hazel::Renderer2D::endScene();
     }
 }
 
+void Sandbox2D::drawTileMap()
+{
+    Hazel::Renderer2D::beginScene(camera_controller_.getCamera());
+    tile_map_->draw(camera_controller_.getCamera());
+    Hazel::Renderer2D::endScene();
+}
+
 void Sandbox2D::onImGuiRender()
 {
     ImGui::Begin("Settings");
@@ -166,6 +185,39 @@ void Sandbox2D::onImGuiRender()
     ImGui::Text("Quads: %d", stats.quad_count);
     ImGui::Text("Vertices: %d", stats.getTotalVertexCount());
     ImGui::Text("Indices: %d", stats.getTotalIndexCount());
+    ImGui::Text("Texture batch breaks: %d", stats.texture_batch_breaks);
+    ImGui::Text("Culled quads: %d", stats.culled_quad_count);
+    ImGui::Text("Static quads: %d", stats.static_quad_count);
+    ImGui::Text("Live particles: %d", particle_system_.getAliveCount());
+
+    auto quad_mode{static_cast<int>(Hazel::Renderer2D::getQuadMode())};
+    if (ImGui::Combo("Quad mode", &quad_mode, "Batched\0Instanced\0Compact\0")) {
+        Hazel::Renderer2D::setQuadMode(static_cast<Hazel::Renderer2D::QuadMode>(quad_mode));
+    }
+
+    auto sorted{Hazel::Renderer2D::getSubmitMode() == Hazel::Renderer2D::SubmitMode::Deferred};
+    if (ImGui::Checkbox("Sort quads", &sorted)) {
+        Hazel::Renderer2D::setSubmitMode(sorted ? Hazel::Renderer2D::SubmitMode::Deferred
+                                                : Hazel::Renderer2D::SubmitMode::Immediate);
+    }
+    auto worker_threads{static_cast<int>(Hazel::Renderer2D::getWorkerThreadCount())};
+    auto const max_worker_threads{static_cast<int>(std::max(std::thread::hardware_concurrency(), 1u)) - 1};
+    if (ImGui::SliderInt("Vertex worker threads", &worker_threads, 0, max_worker_threads)) {
+        Hazel::Renderer2D::setWorkerThreadCount(static_cast<std::uint32_t>(worker_threads));
+    }
+    auto gpu_particles{particle_system_.getMode() == Hazel::ParticleSystem::Mode::Gpu};
+    if (ImGui::Checkbox("GPU particles", &gpu_particles)) {
+        particle_system_.setMode(gpu_particles ? Hazel::ParticleSystem::Mode::Gpu : Hazel::ParticleSystem::Mode::Cpu);
+    }
+    auto particle_threads{static_cast<int>(particle_system_.getWorkerThreadCount())};
+    if (ImGui::SliderInt("Particle worker threads", &particle_threads, 0, max_worker_threads)) {
+        particle_system_.setWorkerThreadCount(static_cast<std::uint32_t>(particle_threads));
+    }
+    ImGui::Checkbox("Draw tile map", &draw_tile_map_);
+    auto culling{Hazel::Renderer2D::isCullingEnabled()};
+    if (ImGui::Checkbox("Cull off-screen quads", &culling)) {
+        Hazel::Renderer2D::setCulling(culling);
+    }
 
     ImGui::ColorEdit4("Square Color", glm::value_ptr(sq_color_));
     ImGui::ColorEdit4("Rectangle Color", glm::value_ptr(rect_color_));
@@ -186,7 +238,7 @@ void Sandbox2D::emitParticles() noexcept
     x = (x / width) * bounds.getWidth() - bounds.getWidth() * 0.5f;
     y = bounds.getHeight() * 0.5f - (y / height) * bounds.getHeight();
     particle_.position = {x + pos.x, y + pos.y};
-    for (int i{0}; i != 5; ++i) particle_system_.emit(particle_);
+    particle_system_.emit(particle_, 5);
 }
 
 }  // namespace Sandbox
@@ -4,8 +4,6 @@
 
 #include "Hazel.h"
 
-#include "ParticleSystem/particle_system.h"
-
 namespace Sandbox
 {
 
@@ -21,11 +19,12 @@ public:
     void onEvent(Hazel::Event&) override;
 
 private:
+    void buildTileMap();
     void drawTileMap();
 
-    constexpr static ParticleProps makeParticle() noexcept
+    constexpr static Hazel::ParticleProps makeParticle() noexcept
     {
-        ParticleProps particle;
+        Hazel::ParticleProps particle;
         particle.color_begin = { 254 / 255.0f, 212 / 255.0f, 123 / 255.0f, 1.0f };
         particle.color_end = { 254 / 255.0f, 109 / 255.0f, 41 / 255.0f, 1.0f };
         particle.size_begin = 0.2f;
@@ -54,9 +53,11 @@ private:
     std::uint32_t map_width_{};
     std::uint32_t map_height_{};
     std::unordered_map<char, Hazel::Ref<Hazel::SubTexture2D>> texture_map_;
+    Hazel::Scope<Hazel::Tilemap> tile_map_;
+    bool draw_tile_map_{false};
 
-    ParticleProps particle_{makeParticle()};
-    ParticleSystem particle_system_{10'000};
+    Hazel::ParticleProps particle_{makeParticle()};
+    Hazel::ParticleSystem particle_system_{10'000};
 };
 
 } // namespace Sandbox
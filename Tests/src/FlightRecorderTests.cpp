@@ -0,0 +1,115 @@
+#include <cstdint>
+#include <vector>
+
+#include <Hazel/Debug/FlightRecorder.h>
+
+#include "Test.h"
+
+namespace Tests {
+
+namespace {
+constexpr const std::uint32_t window_frames{10};
+constexpr const std::int64_t budget_ticks{100};
+
+struct Capture {
+    std::uint32_t frames_fed;  // frames fed before the capture was handed out
+    bool over_budget;
+    std::vector<Hazel::FlightRecorderFrame> frames;
+};
+
+// Feeds frames to a FlightRecorder the way the Instrumentor does - the events of each frame followed by a drain pass -
+// and collects the captures it hands out
+class FrameFeeder {
+public:
+    explicit FrameFeeder(Hazel::FlightRecorder& recorder) noexcept : recorder_{recorder} {}
+
+    void feed(std::int64_t duration, std::uint32_t count = 1)
+    {
+        for (std::uint32_t i{0}; i != count; ++i) {
+            recorder_.addFrameMark(time_, 0);
+            recorder_.addScope(0, time_, time_ + duration / 2, 0, {});
+            time_ += duration;
+            ++frames_fed_;
+
+            auto const& capture{recorder_.endPass()};
+            if (!capture.empty()) {
+                captures_.push_back(Capture{frames_fed_, recorder_.isOverBudget(), {}});
+                for (auto const* frame : capture) {
+                    captures_.back().frames.push_back(*frame);
+                }
+            }
+        }
+    }
+
+    std::vector<Capture> const& getCaptures() const noexcept { return captures_; }
+    std::uint32_t getFramesFed() const noexcept { return frames_fed_; }
+
+private:
+    Hazel::FlightRecorder& recorder_;
+    std::int64_t time_{0};
+    std::uint32_t frames_fed_{0};
+    std::vector<Capture> captures_{};
+};
+}  // namespace
+
+void registerFlightRecorderTests(Suite& suite)
+{
+    suite.add("FlightRecorder: a budget capture every window, not every frame", [] {
+        Hazel::FlightRecorder recorder{window_frames, budget_ticks};
+        FrameFeeder feeder{recorder};
+
+        feeder.feed(budget_ticks / 2, 3 * window_frames);
+        HZ_CHECK_EQUAL(feeder.getCaptures().size(), 0u);
+
+        // A spike, then every frame over the budget - as with VSync and a budget below the refresh period
+        feeder.feed(2 * budget_ticks);
+        auto const spike_fed{feeder.getFramesFed()};
+        // A frame is closed two drain passes after its own mark
+        while (feeder.getCaptures().empty() && feeder.getFramesFed() != spike_fed + 3) {
+            feeder.feed(budget_ticks * 3 / 2);
+        }
+        HZ_CHECK_EQUAL(feeder.getCaptures().size(), 1u);
+        if (feeder.getCaptures().size() != 1) {
+            return;
+        }
+        auto const first{feeder.getCaptures()[0]};
+        HZ_CHECK(first.over_budget);
+        HZ_CHECK_EQUAL(first.frames.size(), window_frames);
+        HZ_CHECK(first.frames_fed > spike_fed);
+        HZ_CHECK_EQUAL(first.frames.back().end - first.frames.back().start, 2 * budget_ticks);
+        for (auto const& frame : first.frames) {
+            HZ_CHECK_EQUAL(frame.events.size(), 1u);
+        }
+
+        // No second capture until the window holds only frames recorded after the first one
+        feeder.feed(budget_ticks * 3 / 2, window_frames - 1);
+        HZ_CHECK_EQUAL(feeder.getCaptures().size(), 1u);
+        feeder.feed(budget_ticks * 3 / 2);
+        HZ_CHECK_EQUAL(feeder.getCaptures().size(), 2u);
+        if (feeder.getCaptures().size() != 2) {
+            return;
+        }
+        auto const& second{feeder.getCaptures()[1]};
+        HZ_CHECK_EQUAL(second.frames_fed - first.frames_fed, window_frames);
+        HZ_CHECK_EQUAL(second.frames.size(), window_frames);
+        HZ_CHECK_EQUAL(second.frames.front().start, first.frames.back().end);
+    });
+
+    suite.add("FlightRecorder: a requested capture is taken at once", [] {
+        Hazel::FlightRecorder recorder{window_frames, 0};
+        FrameFeeder feeder{recorder};
+
+        feeder.feed(budget_ticks * 10, 3 * window_frames);
+        HZ_CHECK_EQUAL(feeder.getCaptures().size(), 0u);
+
+        recorder.requestCapture();
+        feeder.feed(budget_ticks);
+        HZ_CHECK_EQUAL(feeder.getCaptures().size(), 1u);
+        if (feeder.getCaptures().size() == 1) {
+            HZ_CHECK(!feeder.getCaptures()[0].over_budget);
+            HZ_CHECK_EQUAL(feeder.getCaptures()[0].frames.size(), window_frames);
+        }
+    });
+}
+
+}  // namespace Tests
@@ -0,0 +1,113 @@
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <Hazel.h>
+#include <Hazel/Renderer/ParticleSystem.h>
+
+#include "Test.h"
+
+namespace Hazel {
+
+// Friend of ParticleSystem - compares the particle state of two systems
+class ParticleSystemInspector {
+public:
+    // Checks that the live particles, and the quads filled by the last draw(), are bitwise equal in both systems
+    static void checkIdentical(ParticleSystem const& actual, ParticleSystem const& expected)
+    {
+        HZ_CHECK_EQUAL(actual.alive_count_, expected.alive_count_);
+        HZ_CHECK_EQUAL(actual.replace_index_, expected.replace_index_);
+        if (actual.alive_count_ != expected.alive_count_) {
+            return;
+        }
+        auto const count{actual.alive_count_};
+        checkSameBytes("position_x", actual.position_x_, expected.position_x_, count);
+        checkSameBytes("position_y", actual.position_y_, expected.position_y_, count);
+        checkSameBytes("velocity_x", actual.velocity_x_, expected.velocity_x_, count);
+        checkSameBytes("velocity_y", actual.velocity_y_, expected.velocity_y_, count);
+        checkSameBytes("rotation", actual.rotation_, expected.rotation_, count);
+        checkSameBytes("angular_velocity", actual.angular_velocity_, expected.angular_velocity_, count);
+        checkSameBytes("life_remaining", actual.life_remaining_, expected.life_remaining_, count);
+        checkSameBytes("inverse_lifetime", actual.inverse_lifetime_, expected.inverse_lifetime_, count);
+        checkSameBytes("size_begin", actual.size_begin_, expected.size_begin_, count);
+        checkSameBytes("size_end", actual.size_end_, expected.size_end_, count);
+        checkSameBytes("color_begin", actual.color_begin_, expected.color_begin_, count);
+        checkSameBytes("color_end", actual.color_end_, expected.color_end_, count);
+
+        HZ_CHECK_EQUAL(actual.quads_.size(), expected.quads_.size());
+        if (actual.quads_.size() == expected.quads_.size()) {
+            checkSameBytes("quads", actual.quads_, expected.quads_, actual.quads_.size());
+        }
+    }
+
+private:
+    template <typename T>
+    static void checkSameBytes(const char* name, std::vector<T> const& actual, std::vector<T> const& expected,
+                               std::size_t count)
+    {
+        if (std::memcmp(actual.data(), expected.data(), count * sizeof(T)) != 0) {
+            ::Tests::fail(__FILE__, __LINE__, std::string{name} + " differs");
+        }
+    }
+};
+
+}  // namespace Hazel
+
+namespace Tests {
+
+namespace {
+// More than one simulation block of 16k particles, so that the blocks have to be merged after every update
+constexpr const std::uint32_t max_particles{40'000};
+constexpr const std::uint64_t seed{7};
+constexpr const float timestep_s{1.0f / 60.0f};
+
+Hazel::ParticleProps makeProps(std::uint32_t frame) noexcept
+{
+    Hazel::ParticleProps props{};
+    props.position = {0.0f, 0.0f};
+    props.velocity = {0.5f, 1.0f};
+    props.velocity_variation = {3.0f, 1.0f};
+    props.color_begin = {1.0f, 0.5f, 0.2f, 1.0f};
+    props.color_end = {0.2f, 0.3f, 0.8f, 0.0f};
+    props.size_begin = 0.5f;
+    props.size_end = 0.0f;
+    props.size_variation = 0.3f;
+    // Particles of different emissions die in different frames, leaving gaps all over the blocks
+    props.lifetime = 0.2f + 0.05f * static_cast<float>(frame % 10u);
+    return props;
+}
+
+// Fills the quads of the particles' last draw()
+void drawParticles(Hazel::ParticleSystem& particles)
+{
+    static const Hazel::OrthographicCamera camera{-16.0f, 16.0f, -9.0f, 9.0f};
+    Hazel::Renderer2D::beginScene(camera);
+    particles.draw();
+    Hazel::Renderer2D::endScene();
+}
+}  // namespace
+
+void registerParticleSystemTests(Suite& suite)
+{
+    suite.add("ParticleSystem: the simulation doesn't depend on the number of threads", [] {
+        Hazel::ParticleSystem single_threaded{max_particles, seed};
+        Hazel::ParticleSystem multi_threaded{max_particles, seed};
+        multi_threaded.setWorkerThreadCount(3);
+
+        // Enough frames to fill the pool, so that new particles replace live ones as well
+        for (std::uint32_t frame{0}; frame != 90; ++frame) {
+            auto const props{makeProps(frame)};
+            for (auto* particles : {&single_threaded, &multi_threaded}) {
+                particles->emit(props, 1'500);
+                particles->emit(props);
+                particles->onUpdate(timestep_s);
+                drawParticles(*particles);
+            }
+            Hazel::ParticleSystemInspector::checkIdentical(multi_threaded, single_threaded);
+        }
+        HZ_CHECK(single_threaded.getAliveCount() > 16 * 1024);
+    });
+}
+
+}  // namespace Tests
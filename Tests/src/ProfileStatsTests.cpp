@@ -0,0 +1,99 @@
+#include <cstdint>
+
+#include <Hazel/Debug/ProfileStats.h>
+
+#include "Test.h"
+
+namespace Tests {
+
+namespace {
+constexpr const std::uint32_t window_frames{100};
+constexpr const double milliseconds_per_tick{0.5};
+
+constexpr const std::uint32_t every_frame_scope{0};
+constexpr const std::uint32_t late_scope{7};
+constexpr const std::uint32_t early_scope{3};
+
+// Feeds `frame_count` frames, frame k lasting 2k ticks - k milliseconds - with a drain pass after each frame mark.
+// Every frame has one 1 tick call of every_frame_scope, the last 10 frames two 1 tick calls of late_scope as well.
+void feedFrames(Hazel::ProfileStats& stats, std::uint32_t frame_count)
+{
+    // Before the first frame mark, so not part of any frame
+    stats.addScope(early_scope, -10, -5, {});
+
+    std::int64_t time{0};
+    for (std::uint32_t k{1}; k <= frame_count; ++k) {
+        stats.addFrameMark(time);
+        stats.addScope(every_frame_scope, time, time + 1, Hazel::AllocationCounters{2, 64});
+        if (k > frame_count - 10) {
+            stats.addScope(late_scope, time, time + 1, {});
+            stats.addScope(late_scope, time + 1, time + 2, {});
+        }
+        time += 2 * std::int64_t{k};
+        stats.endPass();
+    }
+    stats.addFrameMark(time);
+    // One pass to see the last mark, one to close the frame it ends
+    stats.endPass();
+    stats.endPass();
+}
+}  // namespace
+
+void registerProfileStatsTests(Suite& suite)
+{
+    suite.add("ProfileStats: frame times over a full window", [] {
+        Hazel::ProfileStats stats{window_frames, milliseconds_per_tick};
+        feedFrames(stats, window_frames + 1);
+        auto const snapshot{stats.getSnapshot()};
+
+        // The first frame has left the window, frames of 2 to 101 ms remain
+        HZ_CHECK_EQUAL(snapshot.frame_count, window_frames);
+        HZ_CHECK_EQUAL(snapshot.frame_time.min_ms, 2.0f);
+        HZ_CHECK_EQUAL(snapshot.frame_time.avg_ms, 51.5f);
+        HZ_CHECK_EQUAL(snapshot.frame_time.max_ms, 101.0f);
+        // The ceil(0.99 * 100) - 1 = 98th of the sorted frames
+        HZ_CHECK_EQUAL(snapshot.frame_time.p99_ms, 100.0f);
+    });
+
+    suite.add("ProfileStats: frame times before the window is full", [] {
+        Hazel::ProfileStats stats{window_frames, milliseconds_per_tick};
+        feedFrames(stats, 10);
+        auto const snapshot{stats.getSnapshot()};
+
+        HZ_CHECK_EQUAL(snapshot.frame_count, 10u);
+        HZ_CHECK_EQUAL(snapshot.frame_time.min_ms, 1.0f);
+        HZ_CHECK_EQUAL(snapshot.frame_time.avg_ms, 5.5f);
+        HZ_CHECK_EQUAL(snapshot.frame_time.max_ms, 10.0f);
+        // ceil(0.99 * 10) - 1 = 9, the slowest frame
+        HZ_CHECK_EQUAL(snapshot.frame_time.p99_ms, 10.0f);
+    });
+
+    suite.add("ProfileStats: scopes added after the first pass are tracked", [] {
+        Hazel::ProfileStats stats{window_frames, milliseconds_per_tick};
+        feedFrames(stats, window_frames + 1);
+        auto const snapshot{stats.getSnapshot()};
+
+        // Slowest average first, the scope before the first frame isn't counted
+        HZ_CHECK_EQUAL(snapshot.scopes.size(), 2u);
+        if (snapshot.scopes.size() != 2) {
+            return;
+        }
+        auto const& late{snapshot.scopes[0]};
+        HZ_CHECK_EQUAL(late.scope_id, late_scope);
+        HZ_CHECK_EQUAL(late.time.min_ms, 1.0f);
+        HZ_CHECK_EQUAL(late.time.avg_ms, 1.0f);
+        HZ_CHECK_EQUAL(late.time.p99_ms, 1.0f);
+        HZ_CHECK_EQUAL(late.calls_per_frame, 0.2f);
+        HZ_CHECK_EQUAL(late.allocations_per_frame, 0.0f);
+
+        auto const& every_frame{snapshot.scopes[1]};
+        HZ_CHECK_EQUAL(every_frame.scope_id, every_frame_scope);
+        HZ_CHECK_EQUAL(every_frame.time.min_ms, 0.5f);
+        HZ_CHECK_EQUAL(every_frame.time.max_ms, 0.5f);
+        HZ_CHECK_EQUAL(every_frame.calls_per_frame, 1.0f);
+        HZ_CHECK_EQUAL(every_frame.allocations_per_frame, 2.0f);
+        HZ_CHECK_EQUAL(every_frame.allocated_bytes_per_frame, 64.0f);
+    });
+}
+
+}  // namespace Tests
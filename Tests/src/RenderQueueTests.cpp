@@ -0,0 +1,82 @@
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <Hazel/Renderer/RenderQueue.h>
+
+#include "Test.h"
+
+namespace Tests {
+
+namespace {
+using Hazel::RenderQueue;
+
+// Checks that the queue's indices are `expected`, in order
+void checkIndices(RenderQueue const& queue, std::vector<std::uint32_t> const& expected)
+{
+    HZ_CHECK_EQUAL(queue.size(), expected.size());
+    for (std::size_t i{0}; i != std::min(queue.size(), expected.size()); ++i) {
+        HZ_CHECK_EQUAL(queue[i].index, expected[i]);
+    }
+}
+}  // namespace
+
+void registerRenderQueueTests(Suite& suite)
+{
+    suite.add("RenderQueue: entries with equal keys keep their submission order", [] {
+        RenderQueue queue;
+        auto const opaque{RenderQueue::makeSortKey(0, false, 0.0f)};
+        auto const translucent{RenderQueue::makeSortKey(0, true, 0.5f)};
+        for (std::uint32_t i{0}; i != 8; ++i) {
+            queue.push(i % 2 == 0 ? translucent : opaque, i);
+        }
+        queue.sort();
+        checkIndices(queue, {1, 3, 5, 7, 0, 2, 4, 6});
+    });
+
+    suite.add("RenderQueue: layers, then opaque, then translucent back to front", [] {
+        RenderQueue queue;
+        queue.push(RenderQueue::makeSortKey(1, true, -5.0f), 0);
+        queue.push(RenderQueue::makeSortKey(0, true, 3.0f), 1);
+        queue.push(RenderQueue::makeSortKey(1, false, 2.0f), 2);
+        queue.push(RenderQueue::makeSortKey(0, true, 0.5f), 3);
+        queue.push(RenderQueue::makeSortKey(0, true, -0.5f), 4);
+        queue.push(RenderQueue::makeSortKey(0, false, -1.0f), 5);
+        queue.push(RenderQueue::makeSortKey(0, true, 0.0f), 6);
+        queue.push(RenderQueue::makeSortKey(0, true, -5.0f), 7);
+        queue.push(RenderQueue::makeSortKey(255, false, 0.0f), 8);
+        queue.push(RenderQueue::makeSortKey(0, false, 4.0f), 9);
+        queue.sort();
+
+        // Opaque entries keep their submission order whatever their z
+        checkIndices(queue, {5, 9, 7, 4, 6, 3, 1, 2, 0, 8});
+    });
+
+    suite.add("RenderQueue: sort matches std::stable_sort", [] {
+        std::mt19937 random{11};
+        std::uniform_int_distribution<std::uint32_t> layer{0, 3};
+        std::uniform_int_distribution<std::uint32_t> translucent{0, 1};
+        std::uniform_real_distribution<float> z{-10.0f, 10.0f};
+
+        RenderQueue queue;
+        std::vector<RenderQueue::Entry> expected;
+        for (std::uint32_t i{0}; i != 20'000; ++i) {
+            auto const key{RenderQueue::makeSortKey(static_cast<std::uint8_t>(layer(random)),
+                                                    translucent(random) != 0, z(random))};
+            queue.push(key, i);
+            expected.push_back(RenderQueue::Entry{key, i});
+        }
+        queue.sort();
+        std::stable_sort(expected.begin(), expected.end(),
+                         [](RenderQueue::Entry const& lhs, RenderQueue::Entry const& rhs) { return lhs.key < rhs.key; });
+
+        std::vector<std::uint32_t> expected_indices;
+        for (auto const& entry : expected) {
+            expected_indices.push_back(entry.index);
+        }
+        checkIndices(queue, expected_indices);
+    });
+}
+
+}  // namespace Tests
@@ -0,0 +1,219 @@
+#include <cstdint>
+#include <vector>
+
+#include <Hazel.h>
+#include <Platform/Null/NullRecorder.h>
+
+#include "Test.h"
+
+namespace Tests {
+
+namespace {
+using Hazel::Renderer2D;
+
+// Quads per batch, see Renderer2DData::max_quads
+constexpr const std::uint32_t batch_quads{10'000};
+// Enough quads for two full batches and a partial one
+constexpr const std::uint32_t scene_quads{25'000};
+
+const glm::vec2 quad_size{0.015f, 0.015f};
+const glm::vec4 quad_color{0.2f, 0.4f, 0.6f, 1.0f};
+
+inline glm::vec3 gridPosition(std::uint32_t i) noexcept
+{
+    return {static_cast<float>(i % 1000u) * 0.02f - 10.0f, static_cast<float>(i / 1000u) * 0.02f - 5.0f, 0.0f};
+}
+
+// Resets the recorded calls, then runs `scene` between Renderer2D::beginScene and endScene
+template <typename Scene>
+std::vector<Hazel::NullDrawCall> const& recordScene(Scene&& scene)
+{
+    static const Hazel::OrthographicCamera camera{-16.0f, 16.0f, -9.0f, 9.0f};
+    auto& recorder{Hazel::NullRecorder::get()};
+    recorder.reset();
+    Renderer2D::resetStats();
+    Renderer2D::beginScene(camera);
+    scene();
+    Renderer2D::endScene();
+    return recorder.getDrawCalls();
+}
+
+void drawFlatQuads(std::uint32_t count)
+{
+    for (std::uint32_t i{0}; i != count; ++i) {
+        Renderer2D::drawQuad(gridPosition(i), quad_size, quad_color);
+    }
+}
+
+// Every draw has to sample the white texture from slot 0 for its flat-colored quads
+void checkWhiteTextureBound(std::vector<Hazel::NullDrawCall> const& draw_calls)
+{
+    for (auto const& draw_call : draw_calls) {
+        HZ_CHECK(draw_call.bound_texture_count >= 1);
+        HZ_CHECK(draw_call.textures[0] != 0);
+    }
+}
+
+// Batched and Compact both draw 4 vertices and 6 indices per quad
+void checkVertexBatches(Renderer2D::QuadMode mode)
+{
+    auto const& draw_calls{recordScene([mode] {
+        Renderer2D::setQuadMode(mode);
+        drawFlatQuads(scene_quads);
+        Renderer2D::setQuadMode(Renderer2D::QuadMode::Batched);
+    })};
+
+    HZ_CHECK_EQUAL(draw_calls.size(), 3u);
+    if (draw_calls.size() == 3) {
+        HZ_CHECK_EQUAL(draw_calls[0].index_count, batch_quads * 6);
+        HZ_CHECK_EQUAL(draw_calls[1].index_count, batch_quads * 6);
+        HZ_CHECK_EQUAL(draw_calls[2].index_count, (scene_quads - 2 * batch_quads) * 6);
+    }
+    for (auto const& draw_call : draw_calls) {
+        HZ_CHECK_EQUAL(draw_call.instance_count, 1u);
+    }
+    checkWhiteTextureBound(draw_calls);
+    HZ_CHECK_EQUAL(Renderer2D::getStats().draw_calls, 3u);
+    HZ_CHECK_EQUAL(Hazel::NullRecorder::get().getIndicesDrawn(), std::uint64_t{scene_quads} * 6);
+}
+}  // namespace
+
+void registerRenderer2DTests(Suite& suite)
+{
+    suite.add("Renderer2D: batched quads are drawn in full batches",
+              [] { checkVertexBatches(Renderer2D::QuadMode::Batched); });
+
+    suite.add("Renderer2D: compact quads are drawn in full batches",
+              [] { checkVertexBatches(Renderer2D::QuadMode::Compact); });
+
+    suite.add("Renderer2D: instanced quads are drawn in full batches", [] {
+        auto const& draw_calls{recordScene([] {
+            Renderer2D::setQuadMode(Renderer2D::QuadMode::Instanced);
+            drawFlatQuads(scene_quads);
+            Renderer2D::setQuadMode(Renderer2D::QuadMode::Batched);
+        })};
+
+        HZ_CHECK_EQUAL(draw_calls.size(), 3u);
+        if (draw_calls.size() == 3) {
+            HZ_CHECK_EQUAL(draw_calls[0].instance_count, batch_quads);
+            HZ_CHECK_EQUAL(draw_calls[1].instance_count, batch_quads);
+            HZ_CHECK_EQUAL(draw_calls[2].instance_count, scene_quads - 2 * batch_quads);
+        }
+        for (auto const& draw_call : draw_calls) {
+            HZ_CHECK_EQUAL(draw_call.index_count, 6u);
+        }
+        checkWhiteTextureBound(draw_calls);
+    });
+
+    suite.add("Renderer2D: a batch is flushed once the texture slots run out", [] {
+        std::vector<Hazel::Ref<Hazel::Texture2D>> textures;
+        for (int i{0}; i != 40; ++i) {
+            textures.push_back(Hazel::Texture2D::create(16, 16));
+        }
+        auto const& draw_calls{recordScene([&textures] {
+            for (std::uint32_t i{0}; i != textures.size(); ++i) {
+                Renderer2D::drawQuad(gridPosition(i), quad_size, textures[i]);
+            }
+        })};
+
+        // The white texture takes slot 0, the other 31 fit the first 31 textures
+        HZ_CHECK_EQUAL(draw_calls.size(), 2u);
+        if (draw_calls.size() == 2) {
+            HZ_CHECK_EQUAL(draw_calls[0].index_count, 31u * 6);
+            HZ_CHECK_EQUAL(draw_calls[0].bound_texture_count, Hazel::NullDrawCall::max_texture_slots);
+            HZ_CHECK_EQUAL(draw_calls[1].index_count, 9u * 6);
+            HZ_CHECK_EQUAL(draw_calls[1].bound_texture_count, 10u);
+            for (std::uint32_t i{0}; i != textures.size(); ++i) {
+                auto const& draw_call{draw_calls[i < 31 ? 0u : 1u]};
+                auto const slot{i < 31 ? i + 1 : i - 30};
+                HZ_CHECK_EQUAL(draw_call.textures[slot], textures[i]->getRendererId());
+            }
+        }
+        checkWhiteTextureBound(draw_calls);
+        HZ_CHECK_EQUAL(Renderer2D::getStats().texture_batch_breaks, 1u);
+    });
+
+    suite.add("Renderer2D: deferred quads are all drawn", [] {
+        auto const& draw_calls{recordScene([] {
+            Renderer2D::setSubmitMode(Renderer2D::SubmitMode::Deferred);
+            drawFlatQuads(scene_quads);
+            Renderer2D::setSubmitMode(Renderer2D::SubmitMode::Immediate);
+        })};
+
+        HZ_CHECK_EQUAL(draw_calls.size(), 3u);
+        HZ_CHECK_EQUAL(Hazel::NullRecorder::get().getIndicesDrawn(), std::uint64_t{scene_quads} * 6);
+        checkWhiteTextureBound(draw_calls);
+    });
+
+    suite.add("Renderer2D: every static batch segment samples the white texture", [] {
+        Hazel::StaticBatch batch;
+        for (std::uint32_t i{0}; i != scene_quads; ++i) {
+            batch.addQuad(gridPosition(i), quad_size, quad_color);
+        }
+        batch.build();
+        HZ_CHECK_EQUAL(batch.getSegments().size(), 3u);
+
+        auto const& draw_calls{recordScene([&batch] { Renderer2D::drawStaticBatch(batch); })};
+
+        HZ_CHECK_EQUAL(draw_calls.size(), 3u);
+        if (draw_calls.size() == 3) {
+            HZ_CHECK_EQUAL(draw_calls[0].index_count, batch_quads * 6);
+            HZ_CHECK_EQUAL(draw_calls[1].index_count, batch_quads * 6);
+            HZ_CHECK_EQUAL(draw_calls[2].index_count, (scene_quads - 2 * batch_quads) * 6);
+        }
+        checkWhiteTextureBound(draw_calls);
+        HZ_CHECK_EQUAL(Renderer2D::getStats().static_quad_count, scene_quads);
+    });
+
+    suite.add("Renderer2D: building a static batch again without new quads keeps it", [] {
+        Hazel::StaticBatch batch;
+        for (std::uint32_t i{0}; i != 3; ++i) {
+            batch.addQuad(gridPosition(i), quad_size, quad_color);
+        }
+        batch.build();
+        batch.build();
+        HZ_CHECK(batch.isBuilt());
+        HZ_CHECK_EQUAL(batch.getQuadCount(), 3u);
+        HZ_CHECK_EQUAL(batch.getSegments().size(), 1u);
+
+        auto const& draw_calls{recordScene([&batch] { Renderer2D::drawStaticBatch(batch); })};
+        HZ_CHECK_EQUAL(draw_calls.size(), 1u);
+        if (draw_calls.size() == 1) {
+            HZ_CHECK_EQUAL(draw_calls[0].index_count, 3u * 6);
+        }
+
+        batch.addQuad(gridPosition(3), quad_size, quad_color);
+        batch.build();
+        HZ_CHECK_EQUAL(batch.getQuadCount(), 1u);
+    });
+
+    suite.add("Renderer2D: quads submitted before a static batch are drawn first", [] {
+        Hazel::StaticBatch batch;
+        batch.addQuad(gridPosition(0), quad_size, quad_color);
+        batch.build();
+
+        auto const& draw_calls{recordScene([&batch] {
+            drawFlatQuads(3);
+            Renderer2D::drawStaticBatch(batch);
+        })};
+
+        HZ_CHECK_EQUAL(draw_calls.size(), 2u);
+        if (draw_calls.size() == 2) {
+            HZ_CHECK_EQUAL(draw_calls[0].index_count, 3u * 6);
+            HZ_CHECK_EQUAL(draw_calls[1].index_count, 6u);
+        }
+    });
+
+    suite.add("Renderer2D: nothing is drawn between scenes", [] {
+        recordScene([] { drawFlatQuads(100); });
+
+        // As Sandbox2D does from onImGuiRender, after the scene has ended
+        auto& recorder{Hazel::NullRecorder::get()};
+        recorder.reset();
+        Renderer2D::setQuadMode(Renderer2D::QuadMode::Instanced);
+        Renderer2D::setQuadMode(Renderer2D::QuadMode::Batched);
+        HZ_CHECK_EQUAL(recorder.getDrawCalls().size(), 0u);
+    });
+}
+
+}  // namespace Tests
@@ -0,0 +1,116 @@
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <Hazel/Renderer/SkylinePacker.h>
+
+#include "Test.h"
+
+namespace Tests {
+
+namespace {
+using Hazel::SkylinePacker;
+
+struct Rect {
+    std::uint32_t x;
+    std::uint32_t y;
+    std::uint32_t width;
+    std::uint32_t height;
+};
+
+bool overlap(Rect const& lhs, Rect const& rhs) noexcept
+{
+    return lhs.x < rhs.x + rhs.width && rhs.x < lhs.x + lhs.width && lhs.y < rhs.y + rhs.height &&
+           rhs.y < lhs.y + lhs.height;
+}
+
+// Checks that the rectangles lie within the page and the packer's used bounds, and that none of them overlap
+void checkPlacements(std::vector<Rect> const& rects, SkylinePacker const& packer, std::uint32_t page_width,
+                     std::uint32_t page_height)
+{
+    std::uint32_t used_width{0};
+    std::uint32_t used_height{0};
+    for (std::size_t i{0}; i != rects.size(); ++i) {
+        auto const& rect{rects[i]};
+        HZ_CHECK(rect.x + rect.width <= page_width);
+        HZ_CHECK(rect.y + rect.height <= page_height);
+        used_width = std::max(used_width, rect.x + rect.width);
+        used_height = std::max(used_height, rect.y + rect.height);
+        for (std::size_t j{i + 1}; j != rects.size(); ++j) {
+            if (overlap(rect, rects[j])) {
+                ::Tests::fail(__FILE__, __LINE__,
+                              "rectangles " + std::to_string(i) + " and " + std::to_string(j) + " overlap");
+            }
+        }
+    }
+    HZ_CHECK_EQUAL(packer.getUsedWidth(), used_width);
+    HZ_CHECK_EQUAL(packer.getUsedHeight(), used_height);
+}
+}  // namespace
+
+void registerSkylinePackerTests(Suite& suite)
+{
+    suite.add("SkylinePacker: rectangles fill a page without overlapping", [] {
+        SkylinePacker packer{64, 64};
+        std::vector<Rect> rects;
+        // 16 squares of 16 pixels tile the page exactly, bottom row first
+        for (std::uint32_t i{0}; i != 16; ++i) {
+            auto const position{packer.insert(16, 16)};
+            HZ_CHECK(position.has_value());
+            if (position) {
+                HZ_CHECK_EQUAL(position->x, (i % 4) * 16);
+                HZ_CHECK_EQUAL(position->y, (i / 4) * 16);
+                rects.push_back(Rect{position->x, position->y, 16, 16});
+            }
+        }
+        checkPlacements(rects, packer, 64, 64);
+        HZ_CHECK(!packer.insert(1, 1).has_value());
+    });
+
+    suite.add("SkylinePacker: rectangles of random sizes don't overlap", [] {
+        constexpr const std::uint32_t page_size{512};
+        std::mt19937 random{5};
+        std::uniform_int_distribution<std::uint32_t> size{1, 64};
+
+        SkylinePacker packer{page_size, page_size};
+        std::vector<Rect> rects;
+        std::uint32_t failed_count{0};
+        while (failed_count != 20) {
+            auto const width{size(random)};
+            auto const height{size(random)};
+            if (auto const position{packer.insert(width, height)}) {
+                rects.push_back(Rect{position->x, position->y, width, height});
+            }
+            else {
+                ++failed_count;
+            }
+        }
+        HZ_CHECK(rects.size() > 100);
+        checkPlacements(rects, packer, page_size, page_size);
+    });
+
+    suite.add("SkylinePacker: a rectangle that doesn't fit leaves the packer unchanged", [] {
+        SkylinePacker packer{64, 64};
+        HZ_CHECK(!packer.insert(65, 1).has_value());
+        HZ_CHECK(!packer.insert(1, 65).has_value());
+
+        auto const first{packer.insert(64, 40)};
+        HZ_CHECK(first.has_value());
+        // Too tall for the 24 rows left
+        HZ_CHECK(!packer.insert(8, 25).has_value());
+        HZ_CHECK_EQUAL(packer.getUsedWidth(), 64u);
+        HZ_CHECK_EQUAL(packer.getUsedHeight(), 40u);
+
+        auto const second{packer.insert(64, 24)};
+        HZ_CHECK(second.has_value());
+        if (second) {
+            HZ_CHECK_EQUAL(second->x, 0u);
+            HZ_CHECK_EQUAL(second->y, 40u);
+        }
+        HZ_CHECK(!packer.insert(1, 1).has_value());
+    });
+}
+
+}  // namespace Tests
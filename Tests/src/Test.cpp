@@ -0,0 +1,40 @@
+#include "Test.h"
+
+#include <cstdio>
+#include <utility>
+
+namespace Tests {
+
+namespace {
+std::uint32_t s_failed_checks{0};
+}  // namespace
+
+void Suite::add(std::string name, TestFn test) { cases_.push_back(Case{std::move(name), std::move(test)}); }
+
+std::uint32_t Suite::run(std::string const& filter) const
+{
+    std::uint32_t run_count{0};
+    std::uint32_t failed_count{0};
+    for (auto const& test_case : cases_) {
+        if (test_case.name.find(filter) == std::string::npos) {
+            continue;
+        }
+        s_failed_checks = 0;
+        test_case.test();
+        ++run_count;
+        if (s_failed_checks != 0) {
+            ++failed_count;
+        }
+        std::printf("%-6s %s\n", s_failed_checks == 0 ? "ok" : "FAILED", test_case.name.c_str());
+    }
+    std::printf("%u of %u cases passed\n", run_count - failed_count, run_count);
+    return failed_count;
+}
+
+void fail(const char* file, int line, std::string const& message)
+{
+    ++s_failed_checks;
+    std::printf("%s:%d: check failed: %s\n", file, line, message.c_str());
+}
+
+}  // namespace Tests
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace Tests {
+
+// A set of named test cases. A case fails if any of its checks fails - the remaining checks of the case still run,
+// so that a single run reports every mismatch.
+class Suite {
+public:
+    using TestFn = std::function<void()>;
+
+    void add(std::string name, TestFn test);
+    // Runs the cases whose name contains `filter`, returns the number of failed cases
+    std::uint32_t run(std::string const& filter) const;
+
+private:
+    struct Case {
+        std::string name;
+        TestFn test;
+    };
+
+    std::vector<Case> cases_{};
+};
+
+// Reports a failed check of the running case
+void fail(const char* file, int line, std::string const& message);
+
+template <typename Actual, typename Expected>
+void checkEqual(Actual const& actual, Expected const& expected, const char* expression, const char* file, int line)
+{
+    if (actual == expected) {
+        return;
+    }
+    std::ostringstream message;
+    message << expression << ": got " << actual << ", expected " << expected;
+    fail(file, line, message.str());
+}
+
+void registerRenderer2DTests(Suite& suite);
+void registerParticleSystemTests(Suite& suite);
+void registerFlightRecorderTests(Suite& suite);
+void registerProfileStatsTests(Suite& suite);
+void registerRenderQueueTests(Suite& suite);
+void registerSkylinePackerTests(Suite& suite);
+
+}  // namespace Tests
+
+#define HZ_CHECK(condition)                                \
+    do {                                                   \
+        if (!(condition)) {                                \
+            ::Tests::fail(__FILE__, __LINE__, #condition); \
+        }                                                  \
+    } while (false)
+
+#define HZ_CHECK_EQUAL(actual, expected) \
+    ::Tests::checkEqual((actual), (expected), #actual " == " #expected, __FILE__, __LINE__)
@@ -0,0 +1,42 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#include <Hazel.h>
+
+#include "Test.h"
+
+// Headless tests of the engine. Rendering is recorded by the Null RendererAPI backend, so no window or GPU is
+// required - the tests check what the renderer asked the backend to do.
+//
+// usage: Tests [--filter <substring>]
+int main(int argc, char** argv)
+{
+    std::string filter{};
+    for (int i{1}; i < argc; ++i) {
+        if (!std::strcmp(argv[i], "--filter") && i + 1 < argc) {
+            filter = argv[++i];
+        }
+        else {
+            std::fprintf(stderr, "usage: %s [--filter <substring>]\n", argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    Hazel::Log::Init();
+    Hazel::RendererAPI::setAPI(Hazel::RendererAPI::API::Null);
+    Hazel::Renderer::init();
+
+    Tests::Suite suite{};
+    Tests::registerRenderer2DTests(suite);
+    Tests::registerParticleSystemTests(suite);
+    Tests::registerFlightRecorderTests(suite);
+    Tests::registerProfileStatsTests(suite);
+    Tests::registerRenderQueueTests(suite);
+    Tests::registerSkylinePackerTests(suite);
+    auto const failed_count{suite.run(filter)};
+
+    Hazel::Renderer2D::shutdown();
+    return failed_count == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}